@@ -0,0 +1,219 @@
+#include "CameraOcclusionComponent.h"
+#include "GameFramework/SpringArmComponent.h"
+#include "GameFramework/Pawn.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "MovingPlatform.h"
+#include "SplinePathPlatform.h"
+
+UCameraOcclusionComponent::UCameraOcclusionComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	// 캐릭터 이동이 끝난 뒤, 카메라 갱신 전에 암 길이를 정함
+	PrimaryComponentTick.TickGroup = TG_PostPhysics;
+	// 로컬 조종 폰이 확인되면 RefreshLocalControl 에서 켬
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+}
+
+void UCameraOcclusionComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	Boom = GetOwner() ? GetOwner()->FindComponentByClass<USpringArmComponent>() : nullptr;
+	if (Boom)
+	{
+		DefaultArmLength = Boom->TargetArmLength;
+		CurrentArmLength = DefaultArmLength;
+		bBoomCollisionTest = Boom->bDoCollisionTest;
+	}
+
+	// 클라이언트의 로컬 폰은 컨트롤러가 아직 복제 전일 수 있음 (그때는 NotifyControllerChanged 에서 다시)
+	RefreshLocalControl();
+}
+
+void UCameraOcclusionComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	ClearFades();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UCameraOcclusionComponent::RefreshLocalControl()
+{
+	const APawn* Pawn = Cast<APawn>(GetOwner());
+	const bool bShouldProbe = Boom && bUseAsyncProbe && !IsNetMode(NM_DedicatedServer) && Pawn && Pawn->IsLocallyControlled();
+	if (bShouldProbe == bProbeActive) return;
+	bProbeActive = bShouldProbe;
+
+	if (bProbeActive)
+	{
+		// 스프링암의 동기 스윕은 끄고 이 컴포넌트가 암 길이를 관리
+		Boom->bDoCollisionTest = false;
+		CurrentArmLength = DefaultArmLength;
+	}
+	else if (Boom)
+	{
+		// 로컬 조종이 끝나면 스프링암을 원래대로 돌려주고 걸어 둔 스윕/페이드는 버림
+		Boom->bDoCollisionTest = bBoomCollisionTest;
+		Boom->TargetArmLength = DefaultArmLength;
+		PendingProbe = FTraceHandle();
+		ClearFades();
+	}
+
+	SetComponentTickEnabled(bProbeActive);
+}
+
+void UCameraOcclusionComponent::ClearFades()
+{
+	for (FFadeEntry& Entry : Fades)
+	{
+		if (UPrimitiveComponent* Primitive = Entry.Primitive.Get())
+		{
+			Primitive->SetCustomPrimitiveDataFloat(FadeDataIndex, 1.f);
+		}
+	}
+	Fades.Reset();
+}
+
+void UCameraOcclusionComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (!Boom) return;
+
+	// 1) 지난 프레임에 건 스윕 결과 읽기 (게임 스레드에서 대기하지 않음)
+	float BlockingDistance = DefaultArmLength;
+	ConsumeProbe(BlockingDistance);
+
+	// 2) 암 길이 보간: 당길 때는 빠르게, 풀 때는 천천히
+	const float TargetLength = FMath::Clamp(BlockingDistance, MinArmLength, DefaultArmLength);
+	const float Speed = TargetLength < CurrentArmLength ? ArmPullInSpeed : ArmReleaseSpeed;
+	CurrentArmLength = FMath::FInterpTo(CurrentArmLength, TargetLength, DeltaTime, Speed);
+	Boom->TargetArmLength = CurrentArmLength;
+
+	UpdateFades(DeltaTime);
+
+	// 3) 다음 프레임 위치로 새 스윕 발행
+	IssueProbe(DeltaTime);
+}
+
+void UCameraOcclusionComponent::ConsumeProbe(float& OutBlockingDistance)
+{
+	UWorld* World = GetWorld();
+	if (!World || !PendingProbe.IsValid()) return;
+
+	FTraceDatum Datum;
+	if (!World->QueryTraceData(PendingProbe, Datum))
+	{
+		// 아직 완료되지 않았으면 이전 결과(현재 암 길이)를 유지
+		OutBlockingDistance = CurrentArmLength;
+		return;
+	}
+	PendingProbe = FTraceHandle();
+
+	for (FFadeEntry& Entry : Fades)
+	{
+		Entry.bOccluding = false;
+	}
+
+	// 오브젝트 타입 스윕은 막힘 없이 경로 위 전부를 돌려주므로 채널 응답으로 직접 거른다.
+	// 페이드 대상이 아니면서 ProbeChannel 을 Block 하는 가장 가까운 히트에서 암을 당김
+	float NearestBlock = TNumericLimits<float>::Max();
+	for (const FHitResult& Hit : Datum.OutHits)
+	{
+		const UPrimitiveComponent* Primitive = Hit.GetComponent();
+		if (Primitive && !ShouldFade(Primitive) && Primitive->GetCollisionResponseToChannel(ProbeChannel) == ECR_Block)
+		{
+			NearestBlock = FMath::Min(NearestBlock, Hit.Distance);
+		}
+	}
+	if (NearestBlock < TNumericLimits<float>::Max())
+	{
+		OutBlockingDistance = NearestBlock;
+	}
+
+	// 당긴 카메라와 피벗 사이의 페이드 대상만 반투명
+	for (const FHitResult& Hit : Datum.OutHits)
+	{
+		UPrimitiveComponent* Primitive = Hit.GetComponent();
+		if (Primitive && Hit.Distance < NearestBlock && ShouldFade(Primitive)
+			&& Primitive->GetCollisionResponseToChannel(ProbeChannel) != ECR_Ignore)
+		{
+			FindOrAddFade(Primitive).bOccluding = true;
+		}
+	}
+}
+
+void UCameraOcclusionComponent::IssueProbe(float DeltaTime)
+{
+	UWorld* World = GetWorld();
+	AActor* Owner = GetOwner();
+	if (!World || !Owner) return;
+
+	// 한 프레임 앞의 피벗을 예측해서 스윕 (USpringArmComponent 와 같이 TargetOffset 은 월드, SocketOffset 은 암 회전 기준)
+	const FRotator ArmRotation = Boom->GetTargetRotation();
+	const FVector Pivot = Boom->GetComponentLocation() + Boom->TargetOffset + Owner->GetVelocity() * DeltaTime;
+	const FVector DesiredCamera = Pivot - ArmRotation.Vector() * DefaultArmLength + FRotationMatrix(ArmRotation).TransformVector(Boom->SocketOffset);
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(AsyncCameraOcclusion), false, Owner);
+
+	// 채널 Multi 스윕은 첫 Block 히트에서 멈추는데, 발판은 ProbeChannel 을 Block 하므로 그 뒤의 벽을 놓친다.
+	// 오브젝트 타입 Multi 스윕은 멈추지 않으므로 페이드 대상 뒤의 벽까지 한 번에 받고 응답은 ConsumeProbe 에서 거름
+	PendingProbe = World->AsyncSweepByObjectType(
+		EAsyncTraceType::Multi,
+		Pivot, DesiredCamera,
+		FQuat::Identity,
+		FCollisionObjectQueryParams(FCollisionObjectQueryParams::InitType::AllObjects),
+		FCollisionShape::MakeSphere(ProbeRadius),
+		Params);
+}
+
+void UCameraOcclusionComponent::UpdateFades(float DeltaTime)
+{
+	for (int32 i = Fades.Num() - 1; i >= 0; --i)
+	{
+		FFadeEntry& Entry = Fades[i];
+		if (!Entry.Primitive.IsValid())
+		{
+			Fades.RemoveAtSwap(i);
+			continue;
+		}
+
+		const float Target = Entry.bOccluding ? FadedOpacity : 1.f;
+		if (FMath::IsNearlyEqual(Entry.Current, Target, 0.001f)) continue;
+
+		Entry.Current = FMath::FInterpTo(Entry.Current, Target, DeltaTime, FadeSpeed);
+		if (FMath::IsNearlyEqual(Entry.Current, Target, 0.01f))
+		{
+			Entry.Current = Target;
+		}
+
+		// 머티리얼 파라미터 검색 없이 인덱스로 바로 설정 (프리미티브 하나에 값 하나)
+		Entry.Primitive->SetCustomPrimitiveDataFloat(FadeDataIndex, Entry.Current);
+	}
+}
+
+bool UCameraOcclusionComponent::ShouldFade(const UPrimitiveComponent* Primitive) const
+{
+	if (Primitive->ComponentHasTag(FadeTag)) return true;
+
+	const AActor* Actor = Primitive->GetOwner();
+	return Actor && (Actor->IsA<AMovingPlatform>() || Actor->IsA<ASplinePathPlatform>() || Actor->ActorHasTag(FadeTag));
+}
+
+UCameraOcclusionComponent::FFadeEntry& UCameraOcclusionComponent::FindOrAddFade(UPrimitiveComponent* Primitive)
+{
+	for (FFadeEntry& Entry : Fades)
+	{
+		if (Entry.Primitive.Get() == Primitive)
+		{
+			return Entry;
+		}
+	}
+
+	// 머티리얼은 건드리지 않음: 발판 컴포넌트는 레벨 GC 클러스터 안에 있을 수 있고,
+	// 클러스터가 만들어진 뒤 생긴 UObject 참조(MID)는 GC가 따라가지 않는다
+	FFadeEntry& Entry = Fades.AddDefaulted_GetRef();
+	Entry.Primitive = Primitive;
+	return Entry;
+}
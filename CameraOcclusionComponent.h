@@ -0,0 +1,105 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "WorldCollision.h"
+#include "CameraOcclusionComponent.generated.h"
+
+class USpringArmComponent;
+class UPrimitiveComponent;
+
+/**
+ *  카메라 붐의 동기 충돌 스윕을 대체하는 비동기 차폐 탐지
+ *  이번 프레임에 다음 프레임 위치로 비동기 스윕을 걸어 두고, 다음 프레임에 결과만 읽는다.
+ *  발판처럼 움직이는 장애물은 카메라를 당기지 않고 커스텀 프리미티브 데이터로 반투명 처리한다.
+ *  (MID 를 만들지 않으므로 GC 클러스터에 든 코스 발판에 새 UObject 참조가 생기지 않음)
+ *  로컬 플레이어가 조종하는 폰에서만 동작한다. 페이드는 모두가 보는 발판 컴포넌트에 쓰이므로
+ *  시뮬레이티드 프록시나 리슨 서버의 원격 폰이 돌면 다른 플레이어의 차폐가 로컬 화면을 가린다.
+ */
+UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
+class OBSTACLEASSUALT_API UCameraOcclusionComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UCameraOcclusionComponent();
+
+	/** false면 스프링암 기본 충돌 검사로 되돌림 */
+	UPROPERTY(EditAnywhere, Category = "Camera|Occlusion")
+	bool bUseAsyncProbe = true;
+
+	/** 이 채널을 Block 하는 컴포넌트가 카메라를 당김 (페이드 대상은 Block 이어도 통과) */
+	UPROPERTY(EditAnywhere, Category = "Camera|Occlusion")
+	TEnumAsByte<ECollisionChannel> ProbeChannel = ECC_Camera;
+
+	UPROPERTY(EditAnywhere, Category = "Camera|Occlusion", meta = (ClampMin = "0.0"))
+	float ProbeRadius = 12.f;
+
+	/** 암 길이 보간 속도 (줄어들 때 / 늘어날 때) */
+	UPROPERTY(EditAnywhere, Category = "Camera|Occlusion", meta = (ClampMin = "0.0"))
+	float ArmPullInSpeed = 20.f;
+
+	UPROPERTY(EditAnywhere, Category = "Camera|Occlusion", meta = (ClampMin = "0.0"))
+	float ArmReleaseSpeed = 4.f;
+
+	UPROPERTY(EditAnywhere, Category = "Camera|Occlusion", meta = (ClampMin = "0.0"))
+	float MinArmLength = 60.f;
+
+	/** 이 태그가 있는 액터/컴포넌트는 카메라를 당기지 않고 페이드 (AMovingPlatform은 태그 없이도 페이드) */
+	UPROPERTY(EditAnywhere, Category = "Camera|Fade")
+	FName FadeTag = TEXT("CameraFade");
+
+	/** 페이드 값을 쓰는 커스텀 프리미티브 데이터 인덱스 (1 = 불투명). 머티리얼의 페이드 파라미터가 같은 인덱스를 읽어야 함 */
+	UPROPERTY(EditAnywhere, Category = "Camera|Fade", meta = (ClampMin = "0"))
+	int32 FadeDataIndex = 0;
+
+	UPROPERTY(EditAnywhere, Category = "Camera|Fade", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float FadedOpacity = 0.25f;
+
+	UPROPERTY(EditAnywhere, Category = "Camera|Fade", meta = (ClampMin = "0.0"))
+	float FadeSpeed = 8.f;
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+	/** 소유 폰의 컨트롤러가 바뀌면 다시 호출 (로컬 조종일 때만 틱, 아니면 스프링암 기본 충돌과 페이드 원상 복구) */
+	void RefreshLocalControl();
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+private:
+	/** 페이드 중인 프리미티브 */
+	struct FFadeEntry
+	{
+		TWeakObjectPtr<UPrimitiveComponent> Primitive;
+		float Current = 1.f;
+		bool bOccluding = false;
+	};
+
+	void ConsumeProbe(float& OutBlockingDistance);
+	void IssueProbe(float DeltaTime);
+	void UpdateFades(float DeltaTime);
+
+	bool ShouldFade(const UPrimitiveComponent* Primitive) const;
+	FFadeEntry& FindOrAddFade(UPrimitiveComponent* Primitive);
+
+	/** 페이드를 모두 불투명으로 되돌리고 비움 */
+	void ClearFades();
+
+	UPROPERTY(Transient)
+	TObjectPtr<USpringArmComponent> Boom;
+
+	FTraceHandle PendingProbe;
+
+	/** 스윕 시작점 → 원하는 카메라 위치까지의 거리 (스윕을 건 시점 기준) */
+	float DefaultArmLength = 400.f;
+	float CurrentArmLength = 400.f;
+
+	/** 지금 암 길이를 관리 중인지, 맡기 전 스프링암의 충돌 검사 설정 */
+	bool bProbeActive = false;
+	bool bBoomCollisionTest = true;
+
+	TArray<FFadeEntry> Fades;
+};
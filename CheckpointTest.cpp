@@ -0,0 +1,202 @@
+#include "ObstacleAssualtCharacter.h"
+#include "Animation/AnimInstance.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "GameMapsSettings.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// 매달림/등반 중 체크포인트 검사 (헤드리스):
+//   UnrealEditor ObstacleAssualt.uproject -game -nullrhi -nosound -unattended
+//     -ExecCmds="Automation RunTests ObstacleAssualt.Checkpoint" -TestExit="Automation Test Queue Empty"
+
+namespace CheckpointTest
+{
+	/** 리스폰 뒤 상태가 유지되는지 지켜볼 프레임 (끊긴 몽타주 콜백이 늦게 오지 않는지 포함) */
+	static constexpr int32 SettleFrames = 10;
+
+	static constexpr double TimeoutSeconds = 10.0;
+}
+
+/**
+ *  로컬 캐릭터를 바닥에서 체크포인트 저장 → 매달림 / 등반 도중 저장 시도 → 리스폰 하고,
+ *  리스폰 뒤 매달림/등반 상태가 풀려 다시 움직일 수 있는지 확인한다.
+ */
+class FCheckpointMidClimbCommand : public IAutomationLatentCommand
+{
+public:
+	explicit FCheckpointMidClimbCommand(FAutomationTestBase* InTest)
+		: Test(InTest)
+	{
+	}
+
+	virtual bool Update() override
+	{
+		AObstacleAssualtCharacter* Runner = Character.Get();
+		if (!Runner)
+		{
+			const UWorld* World = AutomationCommon::GetAnyGameWorld();
+			const APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+			Character = PC ? Cast<AObstacleAssualtCharacter>(PC->GetPawn()) : nullptr;
+			if (!Character.IsValid())
+			{
+				if (GetCurrentRunTime() < CheckpointTest::TimeoutSeconds) return false;
+
+				Test->AddError(TEXT("No locally controlled AObstacleAssualtCharacter"));
+				return true;
+			}
+			return false;
+		}
+
+		UCharacterMovementComponent* Move = Runner->GetCharacterMovement();
+		if (!Move)
+		{
+			Test->AddError(TEXT("Runner has no CharacterMovementComponent"));
+			return true;
+		}
+
+		if (SettleFramesLeft < 0)
+		{
+			// 스폰 직후 낙하가 끝나 바닥에 선 뒤 시작
+			if (!Move->IsMovingOnGround())
+			{
+				if (GetCurrentRunTime() < CheckpointTest::TimeoutSeconds) return false;
+
+				Test->AddError(TEXT("Runner never landed"));
+				return true;
+			}
+
+			RunMidHang(*Runner);
+			RunMidClimb(*Runner);
+			RunFlyingSnapshot(*Runner);
+			SettleFramesLeft = CheckpointTest::SettleFrames;
+			return false;
+		}
+
+		if (--SettleFramesLeft > 0) return false;
+
+		CheckReleased(*Runner, TEXT("after settling"));
+		return true;
+	}
+
+private:
+	void SaveGroundCheckpoint(AObstacleAssualtCharacter& Runner)
+	{
+		Runner.SaveCheckpoint();
+		GroundLocation = Runner.GetActorLocation();
+		Test->TestTrue(TEXT("Checkpoint saved on the ground"), Runner.bHasCheckpoint);
+	}
+
+	/** 러너 바로 앞 벽 위의 가짜 레지 */
+	FLedgeInfo MakeLedge(const AObstacleAssualtCharacter& Runner) const
+	{
+		const FVector Forward = Runner.GetActorForwardVector();
+
+		FLedgeInfo Info;
+		Info.WallNormal = -Forward;
+		Info.WallImpactPoint = Runner.GetActorLocation() + Forward * 60.f;
+		Info.LedgeTopPoint = Info.WallImpactPoint + FVector(0.f, 0.f, 150.f);
+		Info.LedgeHeightWorld = Info.LedgeTopPoint.Z;
+		Info.HitActor = const_cast<AObstacleAssualtCharacter*>(&Runner);
+		return Info;
+	}
+
+	/** 매달린 채 저장하면 거부되고, 리스폰은 바닥 체크포인트로 돌아가야 함 */
+	void RunMidHang(AObstacleAssualtCharacter& Runner)
+	{
+		SaveGroundCheckpoint(Runner);
+
+		Runner.EnterHang(MakeLedge(Runner));
+		Test->TestTrue(TEXT("Hanging after EnterHang"), Runner.bIsHanging);
+
+		Runner.SaveCheckpoint();
+		Test->TestTrue(TEXT("Mid-hang save keeps the ground checkpoint"),
+			Runner.Checkpoint.Transform.GetLocation().Equals(GroundLocation, 1.f));
+
+		Runner.RespawnAtCheckpoint();
+		CheckReleased(Runner, TEXT("mid-hang respawn"));
+	}
+
+	/** 등반 몽타주 재생 중 저장/리스폰. 몽타주가 없는 캐릭터면 StartClimbUpSequence 가 즉시 끝나므로 상태를 직접 만든다 */
+	void RunMidClimb(AObstacleAssualtCharacter& Runner)
+	{
+		SaveGroundCheckpoint(Runner);
+
+		Runner.EnterHang(MakeLedge(Runner));
+		Runner.StartClimbUpSequence();
+		if (!Runner.bClimbInProgress)
+		{
+			Test->AddInfo(TEXT("No ClimbUpMontage: simulating the mid-climb state"));
+			Runner.bClimbInProgress = true;
+			Runner.bIsHanging = true;
+			Runner.GetCharacterMovement()->SetMovementMode(MOVE_Flying);
+		}
+
+		Runner.SaveCheckpoint();
+		Test->TestTrue(TEXT("Mid-climb save keeps the ground checkpoint"),
+			Runner.Checkpoint.Transform.GetLocation().Equals(GroundLocation, 1.f));
+
+		Runner.RespawnAtCheckpoint();
+		CheckReleased(Runner, TEXT("mid-climb respawn"));
+
+		if (const UAnimInstance* Anim = Runner.GetMesh() ? Runner.GetMesh()->GetAnimInstance() : nullptr)
+		{
+			Test->TestFalse(TEXT("Climb montage stopped by the respawn"),
+				Runner.ClimbUpMontage && Anim->Montage_IsPlaying(Runner.ClimbUpMontage));
+		}
+	}
+
+	/** 예전에 저장된 Flying 스냅샷을 복원해도 갇히지 않아야 함 */
+	void RunFlyingSnapshot(AObstacleAssualtCharacter& Runner)
+	{
+		FRunnerSnapshot Snapshot;
+		Runner.CaptureRunnerState(Snapshot);
+		Snapshot.MovementMode = MOVE_Flying;
+
+		Runner.RestoreRunnerState(Snapshot);
+		CheckReleased(Runner, TEXT("Flying snapshot restore"));
+	}
+
+	void CheckReleased(AObstacleAssualtCharacter& Runner, const TCHAR* When)
+	{
+		const UCharacterMovementComponent* Move = Runner.GetCharacterMovement();
+
+		Test->TestFalse(FString::Printf(TEXT("%s: not hanging"), When), Runner.bIsHanging);
+		Test->TestFalse(FString::Printf(TEXT("%s: not climbing"), When), Runner.bClimbInProgress);
+		Test->TestTrue(FString::Printf(TEXT("%s: walking or falling (mode %d)"), When, (int32)Move->MovementMode.GetValue()),
+			Move->MovementMode == MOVE_Walking || Move->MovementMode == MOVE_NavWalking || Move->MovementMode == MOVE_Falling);
+		Test->TestTrue(FString::Printf(TEXT("%s: controller rotation restored"), When),
+			Move->bUseControllerDesiredRotation && Move->bOrientRotationToMovement);
+		Test->TestTrue(FString::Printf(TEXT("%s: back at the ground checkpoint"), When),
+			Runner.GetActorLocation().Equals(GroundLocation, 5.f) || Move->MovementMode == MOVE_Falling);
+	}
+
+	FAutomationTestBase* Test;
+	TWeakObjectPtr<AObstacleAssualtCharacter> Character;
+	FVector GroundLocation = FVector::ZeroVector;
+
+	/** -1 = 아직 시나리오 전 */
+	int32 SettleFramesLeft = -1;
+};
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCheckpointMidClimbTest, "ObstacleAssualt.Checkpoint.MidClimbRespawn",
+	EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FCheckpointMidClimbTest::RunTest(const FString& Parameters)
+{
+	const FString Map = UGameMapsSettings::GetGameDefaultMap();
+	if (!TestTrue(TEXT("Open default game map"), AutomationOpenMap(Map)))
+	{
+		return false;
+	}
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForMapToLoadCommand());
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckpointMidClimbCommand(this));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,221 @@
+#include "CourseInitSchedulerSubsystem.h"
+#include "HitchRecorder.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "ObstacleAssualt.h"
+
+static TAutoConsoleVariable<int32> CVarCourseInitEnable(
+	TEXT("oa.CourseInit.Enable"),
+	1,
+	TEXT("발판/러너 초기화를 프레임 예산으로 나눠 실행 (0이면 BeginPlay에서 바로)"));
+
+static TAutoConsoleVariable<float> CVarCourseInitBudgetMs(
+	TEXT("oa.CourseInit.BudgetMs"),
+	2.0f,
+	TEXT("프레임당 초기화에 쓸 시간 (ms). 예산을 넘어도 프레임당 최소 1개는 실행"));
+
+static TAutoConsoleVariable<float> CVarCourseInitResortDistance(
+	TEXT("oa.CourseInit.ResortDistance"),
+	500.f,
+	TEXT("플레이어가 이만큼(cm) 움직이면 남은 작업을 거리순으로 다시 정렬"));
+
+static FAutoConsoleCommandWithWorld CourseInitStatsCommand(
+	TEXT("oa.CourseInit.Stats"),
+	TEXT("초기화 스케줄러 대기 수와 프레임 비용 출력"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (const UCourseInitSchedulerSubsystem* Scheduler = World ? World->GetSubsystem<UCourseInitSchedulerSubsystem>() : nullptr)
+		{
+			UE_LOG(LogObstacleAssualt, Display, TEXT("%s"), *Scheduler->DescribeStats());
+		}
+	}));
+
+static FAutoConsoleCommandWithWorld CourseInitFlushCommand(
+	TEXT("oa.CourseInit.Flush"),
+	TEXT("남은 초기화 작업을 이번 프레임에 전부 실행 (비교 측정용)"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (UCourseInitSchedulerSubsystem* Scheduler = World ? World->GetSubsystem<UCourseInitSchedulerSubsystem>() : nullptr)
+		{
+			Scheduler->Flush();
+		}
+	}));
+
+UCourseInitSchedulerSubsystem* UCourseInitSchedulerSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (CVarCourseInitEnable.GetValueOnGameThread() == 0) return nullptr;
+
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UCourseInitSchedulerSubsystem>() : nullptr;
+}
+
+bool UCourseInitSchedulerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UCourseInitSchedulerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCourseInitSchedulerSubsystem, STATGROUP_Tickables);
+}
+
+void UCourseInitSchedulerSubsystem::Schedule(AActor* Owner, TFunction<void()>&& Init)
+{
+	if (!Owner || !Init) return;
+
+	FTask& Task = Tasks.AddDefaulted_GetRef();
+	Task.Owner = Owner;
+	Task.Init = MoveTemp(Init);
+	Task.Location = Owner->GetActorLocation();
+	bSortDirty = true;
+}
+
+void UCourseInitSchedulerSubsystem::SortIfNeeded()
+{
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	// 로컬 플레이어는 시점, 서버에서는 모든 플레이어 폰 위치 (가장 가까운 쪽 기준)
+	TArray<FVector, TInlineAllocator<4>> Origins;
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (!PC) continue;
+
+		if (PC->IsLocalController())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			Origins.Add(ViewLocation);
+		}
+		else if (const APawn* Pawn = PC->GetPawn())
+		{
+			Origins.Add(Pawn->GetActorLocation());
+		}
+	}
+
+	// 플레이어가 아직 없으면 예약 순서대로 (정렬하지 않음)
+	if (Origins.Num() == 0) return;
+
+	bool bMoved = !bHasSortOrigins || Origins.Num() != SortOrigins.Num();
+	if (!bMoved)
+	{
+		const double ResortDistSq = FMath::Square((double)CVarCourseInitResortDistance.GetValueOnGameThread());
+		for (int32 i = 0; i < Origins.Num() && !bMoved; ++i)
+		{
+			bMoved = FVector::DistSquared(Origins[i], SortOrigins[i]) > ResortDistSq;
+		}
+	}
+	if (!bMoved && !bSortDirty) return;
+
+	for (FTask& Task : Tasks)
+	{
+		double Best = TNumericLimits<double>::Max();
+		for (const FVector& Origin : Origins)
+		{
+			Best = FMath::Min(Best, FVector::DistSquared(Origin, Task.Location));
+		}
+		Task.DistSq = Best;
+	}
+	// 안정 정렬이라 거리가 같으면 예약 순서 유지
+	Tasks.StableSort([](const FTask& A, const FTask& B) { return A.DistSq > B.DistSq; });
+
+	SortOrigins = Origins;
+	bHasSortOrigins = true;
+	bSortDirty = false;
+}
+
+bool UCourseInitSchedulerSubsystem::RunTask(FTask& Task)
+{
+	if (!Task.Owner.IsValid()) return false;
+
+	Task.Init();
+	return true;
+}
+
+void UCourseInitSchedulerSubsystem::Tick(float DeltaTime)
+{
+	if (Tasks.Num() == 0) return;
+
+	if (!HitchRecorder) HitchRecorder = UHitchRecorderSubsystem::Get(this);
+	FHitchScope HitchScope(HitchRecorder, EHitchScope::CourseInit);
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	SortIfNeeded();
+
+	const double BudgetMs = FMath::Max(0.0, (double)CVarCourseInitBudgetMs.GetValueOnGameThread());
+	int32 Ran = 0;
+	double ElapsedMs = 0.0;
+
+	// 가까운 것부터 (배열 끝). 작업 안에서 새 작업이 예약될 수 있으므로 꺼낸 뒤 실행
+	while (Tasks.Num() > 0)
+	{
+		FTask Task = Tasks.Pop(EAllowShrinking::No);
+		Ran += RunTask(Task) ? 1 : 0;
+
+		ElapsedMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+		if (ElapsedMs >= BudgetMs) break;
+	}
+
+	++BurstFrames;
+	BurstTasks += Ran;
+	BurstMs += ElapsedMs;
+	BurstWorstFrameMs = FMath::Max(BurstWorstFrameMs, ElapsedMs);
+	TotalTasks += Ran;
+	WorstFrameMs = FMath::Max(WorstFrameMs, ElapsedMs);
+
+	if (Tasks.Num() == 0)
+	{
+		NoteBurstFinished();
+	}
+}
+
+void UCourseInitSchedulerSubsystem::Flush()
+{
+	if (Tasks.Num() == 0) return;
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	SortIfNeeded();
+
+	int32 Ran = 0;
+	while (Tasks.Num() > 0)
+	{
+		FTask Task = Tasks.Pop(EAllowShrinking::No);
+		Ran += RunTask(Task) ? 1 : 0;
+	}
+
+	const double ElapsedMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+	++BurstFrames;
+	BurstTasks += Ran;
+	BurstMs += ElapsedMs;
+	BurstWorstFrameMs = FMath::Max(BurstWorstFrameMs, ElapsedMs);
+	TotalTasks += Ran;
+	WorstFrameMs = FMath::Max(WorstFrameMs, ElapsedMs);
+
+	NoteBurstFinished();
+}
+
+void UCourseInitSchedulerSubsystem::NoteBurstFinished()
+{
+	UE_LOG(LogObstacleAssualt, Log, TEXT("CourseInit: %d tasks over %d frames (%.2f ms total, worst frame %.2f ms)"),
+		BurstTasks, BurstFrames, BurstMs, BurstWorstFrameMs);
+
+	++TotalBursts;
+	BurstTasks = 0;
+	BurstFrames = 0;
+	BurstMs = 0.0;
+	BurstWorstFrameMs = 0.0;
+
+	Tasks.Empty();
+	bHasSortOrigins = false;
+}
+
+FString UCourseInitSchedulerSubsystem::DescribeStats() const
+{
+	return FString::Printf(TEXT("CourseInit: %d pending, %d run in current burst over %d frames (worst %.2f ms); total %d tasks in %d bursts, worst frame %.2f ms, budget %.2f ms"),
+		Tasks.Num(), BurstTasks, BurstFrames, BurstWorstFrameMs, TotalTasks, TotalBursts, WorstFrameMs,
+		CVarCourseInitBudgetMs.GetValueOnGameThread());
+}
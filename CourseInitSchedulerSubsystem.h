@@ -0,0 +1,82 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CourseInitSchedulerSubsystem.generated.h"
+
+class UHitchRecorderSubsystem;
+
+/**
+ *  코스/스트리밍 청크 로드 직후 몰리는 액터 초기화를 여러 프레임으로 나눠 실행
+ *  발판/러너는 BeginPlay에서 무거운 초기화를 Schedule 로 넘기고, 스케줄러는 매 프레임
+ *  oa.CourseInit.BudgetMs 안에서 플레이어와 가까운 것부터 실행한다 (프레임당 최소 1개).
+ *  대기 중인 발판은 멈춰 있다가 활성화될 때 흐른 시간만큼 위상을 맞춰서 시작한다.
+ */
+UCLASS()
+class OBSTACLEASSUALT_API UCourseInitSchedulerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** 월드에서 스케줄러를 찾는다 (없거나 꺼져 있으면 nullptr → 호출자가 바로 초기화) */
+	static UCourseInitSchedulerSubsystem* Get(const UObject* WorldContextObject);
+
+	/** Owner 위치 기준 우선순위로 Init을 나중 프레임에 실행. Owner가 먼저 사라지면 버림 */
+	void Schedule(AActor* Owner, TFunction<void()>&& Init);
+
+	/** 남은 작업을 이번 프레임에 전부 실행 */
+	void Flush();
+
+	int32 GetPendingCount() const { return Tasks.Num(); }
+
+	/** 통계 한 줄 (oa.CourseInit.Stats) */
+	FString DescribeStats() const;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	struct FTask
+	{
+		TWeakObjectPtr<AActor> Owner;
+		TFunction<void()> Init;
+		/** 예약 시점 위치 (초기화 전 액터는 움직이지 않음) */
+		FVector Location = FVector::ZeroVector;
+		double DistSq = 0.0;
+	};
+
+	/** 플레이어 위치가 충분히 바뀌었거나 새 작업이 들어왔으면 먼 것 → 가까운 것 순으로 다시 정렬 */
+	void SortIfNeeded();
+
+	/** 작업 하나 실행. 실행했으면 true */
+	bool RunTask(FTask& Task);
+
+	void NoteBurstFinished();
+
+	/** 끝에서 꺼내므로 가장 가까운 작업이 배열 마지막 */
+	TArray<FTask> Tasks;
+
+	bool bSortDirty = false;
+	bool bHasSortOrigins = false;
+	TArray<FVector, TInlineAllocator<4>> SortOrigins;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UHitchRecorderSubsystem> HitchRecorder;
+
+	// 현재 몰림(큐가 빌 때까지) 통계
+	int32 BurstTasks = 0;
+	int32 BurstFrames = 0;
+	double BurstMs = 0.0;
+	double BurstWorstFrameMs = 0.0;
+
+	// 누적 통계
+	int32 TotalTasks = 0;
+	int32 TotalBursts = 0;
+	double WorstFrameMs = 0.0;
+};
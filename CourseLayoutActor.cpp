@@ -0,0 +1,623 @@
+#include "CourseLayoutActor.h"
+#include "MovingPlatform.h"
+#include "GameplayMathBridge.h"
+#include "Async/MappedFileHandle.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/SceneComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Character.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Kismet/GameplayStatics.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ObstacleAssualt.h"
+
+namespace CourseLayout
+{
+	static FString ResolvePath(const FString& Path)
+	{
+		return FPaths::IsRelative(Path) ? FPaths::Combine(FPaths::ProjectDir(), Path) : Path;
+	}
+
+	static FString DefaultPath(const UWorld* World)
+	{
+		return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("CourseLayouts"),
+			UGameplayStatics::GetCurrentLevelName(World, /*bRemovePrefixString=*/true) + TEXT(".oacl"));
+	}
+
+	static double UsedPhysicalMB()
+	{
+		return FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0);
+	}
+
+	static void ToFloat3(const FVector& V, float Out[3])
+	{
+		Out[0] = (float)V.X;
+		Out[1] = (float)V.Y;
+		Out[2] = (float)V.Z;
+	}
+
+	static void ToFloat3(const FRotator& R, float Out[3])
+	{
+		Out[0] = (float)R.Pitch;
+		Out[1] = (float)R.Yaw;
+		Out[2] = (float)R.Roll;
+	}
+
+	static FVector ToVector(const float In[3])
+	{
+		return FVector(In[0], In[1], In[2]);
+	}
+
+	static FRotator ToRotator(const float In[3])
+	{
+		return FRotator(In[0], In[1], In[2]);
+	}
+
+	static bool SaveBytes(const std::vector<uint8_t>& Bytes, const FString& Path)
+	{
+		IFileManager::Get().MakeDirectory(*FPaths::GetPath(Path), /*Tree=*/true);
+		return FFileHelper::SaveArrayToFile(TArrayView<const uint8>(Bytes.data(), (int32)Bytes.size()), *Path);
+	}
+
+	/** 메시 테이블에 경로를 넣고 인덱스 반환 */
+	static uint32 AddMesh(std::vector<GameplayMath::FCourseLayoutMesh>& Meshes, TMap<FString, uint32>& Indices, const FString& MeshPath)
+	{
+		if (const uint32* Existing = Indices.Find(MeshPath))
+		{
+			return *Existing;
+		}
+
+		// 경로 칸은 널 포함 256바이트. 넘치면 잘려서 로드 때 메시를 못 찾으므로 알림
+		const FTCHARToUTF8 Utf8Path(*MeshPath);
+		GameplayMath::FCourseLayoutMesh Mesh = {};
+		if (Utf8Path.Length() >= (int32)sizeof(Mesh.Path))
+		{
+			UE_LOG(LogObstacleAssualt, Warning, TEXT("CourseLayout: mesh path is %d bytes (max %d), truncated: %s"),
+				Utf8Path.Length(), (int32)sizeof(Mesh.Path) - 1, *MeshPath);
+		}
+		FCStringAnsi::Strncpy(Mesh.Path, Utf8Path.Get(), sizeof(Mesh.Path));
+		Meshes.push_back(Mesh);
+		return Indices.Add(MeshPath, (uint32)Meshes.size() - 1);
+	}
+}
+
+static FAutoConsoleCommandWithWorldAndArgs CourseLayoutExportCommand(
+	TEXT("oa.CourseLayout.Export"),
+	TEXT("현재 월드의 발판/Climbable 액터를 레이아웃 파일로 내보내기: oa.CourseLayout.Export [Path]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World) return;
+
+		const FString Path = Args.Num() > 0 ? CourseLayout::ResolvePath(Args[0]) : CourseLayout::DefaultPath(World);
+		int32 NumPlatforms = 0;
+		int32 NumLedges = 0;
+		if (ACourseLayoutActor::ExportWorld(World, Path, NumPlatforms, NumLedges))
+		{
+			UE_LOG(LogObstacleAssualt, Display, TEXT("CourseLayout: exported %d platforms, %d ledges to %s"), NumPlatforms, NumLedges, *Path);
+		}
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs CourseLayoutGenerateCommand(
+	TEXT("oa.CourseLayout.Generate"),
+	TEXT("부하 측정용 합성 레이아웃 생성: oa.CourseLayout.Generate [NumPlatforms=50000] [Path]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		const int32 NumPlatforms = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 50000;
+		const FString Path = Args.Num() > 1 ? CourseLayout::ResolvePath(Args[1])
+			: FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("CourseLayouts"), FString::Printf(TEXT("Synthetic_%d.oacl"), NumPlatforms));
+
+		if (ACourseLayoutActor::WriteSynthetic(Path, NumPlatforms))
+		{
+			UE_LOG(LogObstacleAssualt, Display, TEXT("CourseLayout: wrote %d synthetic platforms to %s"), NumPlatforms, *Path);
+		}
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs CourseLayoutLoadCommand(
+	TEXT("oa.CourseLayout.Load"),
+	TEXT("레이아웃을 불러오고 로드 시간/메모리 증가량 출력: oa.CourseLayout.Load [Path]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World || !World->IsGameWorld()) return;
+
+		const FString Path = Args.Num() > 0 ? CourseLayout::ResolvePath(Args[0]) : CourseLayout::DefaultPath(World);
+		const double StartMB = CourseLayout::UsedPhysicalMB();
+		const double StartSeconds = FPlatformTime::Seconds();
+
+		ACourseLayoutActor* Layout = World->SpawnActor<ACourseLayoutActor>();
+		if (!Layout || !Layout->LoadLayout(Path))
+		{
+			if (Layout) Layout->Destroy();
+			return;
+		}
+
+		UE_LOG(LogObstacleAssualt, Display, TEXT("CourseLayout: %d platforms + %d ledges in %.1f ms, resident +%.1f MB (now %.1f MB)"),
+			Layout->GetNumPlatforms(), Layout->GetNumLedges(), (FPlatformTime::Seconds() - StartSeconds) * 1000.0,
+			CourseLayout::UsedPhysicalMB() - StartMB, CourseLayout::UsedPhysicalMB());
+	}));
+
+static FAutoConsoleCommandWithWorld CourseLayoutMemStatsCommand(
+	TEXT("oa.CourseLayout.MemStats"),
+	TEXT("상주 메모리와 액터 수 출력 (.umap 로드와 비교용)"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (!World) return;
+
+		int32 NumActors = 0;
+		int32 NumPlatforms = 0;
+		for (TActorIterator<AActor> It(World); It; ++It)
+		{
+			++NumActors;
+			NumPlatforms += It->IsA<AMovingPlatform>() ? 1 : 0;
+		}
+
+		UE_LOG(LogObstacleAssualt, Display, TEXT("CourseLayout: resident %.1f MB, %d actors (%d AMovingPlatform)"),
+			CourseLayout::UsedPhysicalMB(), NumActors, NumPlatforms);
+	}));
+
+ACourseLayoutActor::ACourseLayoutActor()
+{
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
+
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+}
+
+void ACourseLayoutActor::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (!LayoutFile.IsEmpty())
+	{
+		LoadLayout(CourseLayout::ResolvePath(LayoutFile));
+	}
+}
+
+void ACourseLayoutActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnloadLayout();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+bool ACourseLayoutActor::LoadLayout(const FString& Path)
+{
+	UnloadLayout();
+
+	// 매핑 → 레코드 배열을 그대로 사용. 매핑이 안 되면 한 번 읽어 둔다
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	const uint8* Data = nullptr;
+	int64 Size = 0;
+
+	MappedFile.Reset(PlatformFile.OpenMapped(*Path));
+	if (MappedFile)
+	{
+		MappedRegion.Reset(MappedFile->MapRegion(0, MappedFile->GetFileSize()));
+	}
+
+	if (MappedRegion)
+	{
+		Data = MappedRegion->GetMappedPtr();
+		Size = MappedRegion->GetMappedSize();
+	}
+	else if (FFileHelper::LoadFileToArray(FallbackBytes, *Path, FILEREAD_Silent))
+	{
+		Data = FallbackBytes.GetData();
+		Size = FallbackBytes.Num();
+	}
+	else
+	{
+		UE_LOG(LogObstacleAssualt, Warning, TEXT("CourseLayout: cannot open %s"), *Path);
+		UnloadLayout();
+		return false;
+	}
+
+	const GameplayMath::ECourseLayoutError Error = GameplayMath::ParseCourseLayout(Data, (size_t)Size, View);
+	if (Error != GameplayMath::ECourseLayoutError::None)
+	{
+		UE_LOG(LogObstacleAssualt, Warning, TEXT("CourseLayout: %s: %s"), *Path, UTF8_TO_TCHAR(GameplayMath::ToString(Error)));
+		UnloadLayout();
+		return false;
+	}
+
+	// 메시별로 나누고 움직이는 발판은 렌더 전용 컴포넌트로 따로 (Tick에서 한 번에 갱신)
+	const int32 NumMeshes = (int32)View.NumMeshes;
+	PlatformComponents.SetNum(NumMeshes);
+	MovingComponents.SetNum(NumMeshes);
+	LedgeComponents.SetNum(NumMeshes);
+	MovingByMesh.SetNum(NumMeshes);
+	MovingProxySlots.SetNum(NumMeshes);
+
+	TArray<TArray<int32>> StaticByMesh;
+	StaticByMesh.SetNum(NumMeshes);
+	for (uint32 i = 0; i < View.NumPlatforms; ++i)
+	{
+		const GameplayMath::FCourseLayoutPlatform& Platform = View.Platforms[i];
+		const bool bMoving = !CourseLayout::ToVector(Platform.Velocity).IsNearlyZero() && Platform.MoveDistance > 0.f;
+		const bool bRotating = !CourseLayout::ToRotator(Platform.RotationVelocity).IsNearlyZero();
+		(bMoving || bRotating ? MovingByMesh : StaticByMesh)[Platform.MeshIndex].Add((int32)i);
+	}
+
+	TArray<FTransform> Transforms;
+	for (int32 MeshIndex = 0; MeshIndex < NumMeshes; ++MeshIndex)
+	{
+		// 움직이는 발판의 충돌은 러너 근처 프록시가 담당 (인스턴스 충돌은 러너를 태워 가지 못함)
+		if (MovingByMesh[MeshIndex].Num() > 0)
+		{
+			UInstancedStaticMeshComponent* Component = CreateMeshComponent(MeshIndex, /*bLedge=*/false, /*bCollision=*/false);
+			MovingComponents[MeshIndex] = Component;
+			MovingProxySlots[MeshIndex].Init(INDEX_NONE, MovingByMesh[MeshIndex].Num());
+
+			Transforms.Reset(MovingByMesh[MeshIndex].Num());
+			for (const int32 Index : MovingByMesh[MeshIndex])
+			{
+				Transforms.Add(EvaluatePlatform(View.Platforms[Index], 0.0));
+			}
+			Component->AddInstances(Transforms, /*bShouldReturnIndices=*/false, /*bWorldSpace=*/true);
+		}
+
+		if (StaticByMesh[MeshIndex].Num() > 0)
+		{
+			UInstancedStaticMeshComponent* Component = CreateMeshComponent(MeshIndex, /*bLedge=*/false, /*bCollision=*/true);
+			PlatformComponents[MeshIndex] = Component;
+
+			Transforms.Reset(StaticByMesh[MeshIndex].Num());
+			for (const int32 Index : StaticByMesh[MeshIndex])
+			{
+				Transforms.Add(EvaluatePlatform(View.Platforms[Index], 0.0));
+			}
+			Component->AddInstances(Transforms, /*bShouldReturnIndices=*/false, /*bWorldSpace=*/true);
+		}
+	}
+
+	for (int32 MeshIndex = 0; MeshIndex < NumMeshes; ++MeshIndex)
+	{
+		Transforms.Reset();
+		for (uint32 i = 0; i < View.NumLedges; ++i)
+		{
+			const GameplayMath::FCourseLayoutLedge& Ledge = View.Ledges[i];
+			if ((int32)Ledge.MeshIndex != MeshIndex) continue;
+
+			Transforms.Add(FTransform(CourseLayout::ToRotator(Ledge.Rotation), CourseLayout::ToVector(Ledge.Location), CourseLayout::ToVector(Ledge.Scale)));
+		}
+		if (Transforms.Num() == 0) continue;
+
+		UInstancedStaticMeshComponent* Component = CreateMeshComponent(MeshIndex, /*bLedge=*/true, /*bCollision=*/true);
+		LedgeComponents[MeshIndex] = Component;
+		Component->AddInstances(Transforms, /*bShouldReturnIndices=*/false, /*bWorldSpace=*/true);
+	}
+
+	LayoutStartSeconds = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+
+	bool bHasMoving = false;
+	for (const TArray<int32>& Moving : MovingByMesh)
+	{
+		bHasMoving |= Moving.Num() > 0;
+	}
+	SetActorTickEnabled(bHasMoving);
+	return true;
+}
+
+void ACourseLayoutActor::UnloadLayout()
+{
+	SetActorTickEnabled(false);
+
+	for (UInstancedStaticMeshComponent* Component : PlatformComponents)
+	{
+		if (Component) Component->DestroyComponent();
+	}
+	for (UInstancedStaticMeshComponent* Component : MovingComponents)
+	{
+		if (Component) Component->DestroyComponent();
+	}
+	for (UInstancedStaticMeshComponent* Component : LedgeComponents)
+	{
+		if (Component) Component->DestroyComponent();
+	}
+	for (UStaticMeshComponent* Component : CollisionProxies)
+	{
+		if (Component) Component->DestroyComponent();
+	}
+	PlatformComponents.Reset();
+	MovingComponents.Reset();
+	LedgeComponents.Reset();
+	CollisionProxies.Reset();
+	ProxyOwners.Reset();
+	MovingByMesh.Reset();
+	MovingProxySlots.Reset();
+	bWarnedProxyPoolFull = false;
+
+	// 뷰가 가리키는 메모리보다 먼저 비움 (영역 → 핸들 순)
+	View = GameplayMath::FCourseLayoutView();
+	MappedRegion.Reset();
+	MappedFile.Reset();
+	FallbackBytes.Empty();
+}
+
+UInstancedStaticMeshComponent* ACourseLayoutActor::CreateMeshComponent(uint32 MeshIndex, bool bLedge, bool bCollision)
+{
+	UInstancedStaticMeshComponent* Component = NewObject<UInstancedStaticMeshComponent>(this);
+	Component->SetupAttachment(RootComponent);
+	Component->SetMobility(EComponentMobility::Movable);
+
+	const FString MeshPath = UTF8_TO_TCHAR(View.Meshes[MeshIndex].Path);
+	if (UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, *MeshPath))
+	{
+		Component->SetStaticMesh(Mesh);
+	}
+	else
+	{
+		UE_LOG(LogObstacleAssualt, Warning, TEXT("CourseLayout: mesh %s not found"), *MeshPath);
+	}
+
+	if (bLedge)
+	{
+		Component->ComponentTags.Add(ClimbableTag);
+	}
+	if (!bCollision)
+	{
+		Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	}
+
+	Component->RegisterComponent();
+	AddInstanceComponent(Component);
+	return Component;
+}
+
+UStaticMeshComponent* ACourseLayoutActor::CreateCollisionProxy()
+{
+	UStaticMeshComponent* Component = NewObject<UStaticMeshComponent>(this);
+	Component->SetupAttachment(RootComponent);
+	Component->SetMobility(EComponentMobility::Movable);
+	Component->SetHiddenInGame(true);
+	Component->SetCastShadow(false);
+	Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+
+	// 보이지 않는 프록시가 카메라를 당기지 않도록 (액터 발판처럼 카메라는 통과)
+	Component->SetCollisionResponseToChannel(ECC_Camera, ECR_Ignore);
+
+	Component->RegisterComponent();
+	AddInstanceComponent(Component);
+	return Component;
+}
+
+void ACourseLayoutActor::GatherRunnerLocations()
+{
+	RunnerLocations.Reset();
+	for (TActorIterator<ACharacter> It(GetWorld()); It; ++It)
+	{
+		if (!It->IsHidden())
+		{
+			RunnerLocations.Add(It->GetActorLocation());
+		}
+	}
+}
+
+void ACourseLayoutActor::UpdateCollisionProxy(int32 MeshIndex, int32 MovingIndex, const FTransform& Transform)
+{
+	float NearestSq = TNumericLimits<float>::Max();
+	for (const FVector& Location : RunnerLocations)
+	{
+		NearestSq = FMath::Min(NearestSq, (float)FVector::DistSquared(Location, Transform.GetLocation()));
+	}
+
+	int32& Slot = MovingProxySlots[MeshIndex][MovingIndex];
+	if (Slot != INDEX_NONE)
+	{
+		// 러너가 떠날 때까지 같은 컴포넌트를 유지 (바꾸면 그 위에 선 러너의 베이스가 끊김)
+		if (NearestSq > FMath::Square(CollisionProxyRadius * 1.25f))
+		{
+			ReleaseCollisionProxy(Slot);
+			return;
+		}
+
+		// 텔레포트가 아닌 일반 이동이라 CharacterMovement 가 위에 선 러너를 같이 옮김
+		CollisionProxies[Slot]->SetWorldTransform(Transform);
+		return;
+	}
+
+	if (NearestSq > FMath::Square(CollisionProxyRadius)) return;
+
+	int32 Free = ProxyOwners.IndexOfByPredicate([](const FIntPoint& Owner) { return Owner.X == INDEX_NONE; });
+	if (Free == INDEX_NONE)
+	{
+		if (CollisionProxies.Num() >= MaxCollisionProxies)
+		{
+			if (!bWarnedProxyPoolFull)
+			{
+				UE_LOG(LogObstacleAssualt, Warning, TEXT("CourseLayout: %d collision proxies in use, moving platforms near runners have no collision (raise MaxCollisionProxies)"),
+					CollisionProxies.Num());
+				bWarnedProxyPoolFull = true;
+			}
+			return;
+		}
+		Free = CollisionProxies.Add(CreateCollisionProxy());
+		ProxyOwners.Add(FIntPoint(INDEX_NONE, INDEX_NONE));
+	}
+
+	UStaticMeshComponent* Proxy = CollisionProxies[Free];
+	const UInstancedStaticMeshComponent* Visual = MovingComponents[MeshIndex];
+	if (Visual && Proxy->GetStaticMesh() != Visual->GetStaticMesh())
+	{
+		Proxy->SetStaticMesh(Visual->GetStaticMesh());
+	}
+	Proxy->SetWorldTransform(Transform, false, nullptr, ETeleportType::TeleportPhysics);
+	Proxy->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+
+	ProxyOwners[Free] = FIntPoint(MeshIndex, MovingIndex);
+	Slot = Free;
+}
+
+void ACourseLayoutActor::ReleaseCollisionProxy(int32 Slot)
+{
+	const FIntPoint Owner = ProxyOwners[Slot];
+	if (Owner.X != INDEX_NONE)
+	{
+		MovingProxySlots[Owner.X][Owner.Y] = INDEX_NONE;
+	}
+	ProxyOwners[Slot] = FIntPoint(INDEX_NONE, INDEX_NONE);
+	CollisionProxies[Slot]->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+}
+
+FTransform ACourseLayoutActor::EvaluatePlatform(const GameplayMath::FCourseLayoutPlatform& Platform, double Time)
+{
+	const FVector Location = FromGameplayMath(GameplayMath::EvaluatePingPongAt(
+		ToGameplayMath(CourseLayout::ToVector(Platform.StartLocation)), ToGameplayMath(CourseLayout::ToVector(Platform.Velocity)),
+		Platform.MoveDistance, Time));
+
+	// AddActorLocalRotation 누적과 같음 (한 축 회전이면 정확, 여러 축이면 근사)
+	const FRotator Spin = CourseLayout::ToRotator(Platform.RotationVelocity) * Time;
+	const FQuat Rotation = FQuat(CourseLayout::ToRotator(Platform.Rotation)) * FQuat(Spin.GetNormalized());
+
+	return FTransform(Rotation, Location, CourseLayout::ToVector(Platform.Scale));
+}
+
+void ACourseLayoutActor::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	// 게임 시간 기준이라 슬로우(타임 딜레이션)도 액터 발판과 똑같이 적용됨
+	const double Time = GetWorld()->GetTimeSeconds() - LayoutStartSeconds;
+
+	if (bMovingPlatformCollision)
+	{
+		GatherRunnerLocations();
+	}
+
+	for (int32 MeshIndex = 0; MeshIndex < MovingByMesh.Num(); ++MeshIndex)
+	{
+		const TArray<int32>& Moving = MovingByMesh[MeshIndex];
+		UInstancedStaticMeshComponent* Component = MovingComponents[MeshIndex];
+		if (Moving.Num() == 0 || !Component) continue;
+
+		ScratchTransforms.Reset(Moving.Num());
+		for (int32 i = 0; i < Moving.Num(); ++i)
+		{
+			const FTransform& Transform = ScratchTransforms.Add_GetRef(EvaluatePlatform(View.Platforms[Moving[i]], Time));
+			if (bMovingPlatformCollision)
+			{
+				UpdateCollisionProxy(MeshIndex, i, Transform);
+			}
+		}
+
+		// 렌더 전용이라 물리 바디 갱신 없음
+		Component->BatchUpdateInstancesTransforms(0, ScratchTransforms, /*bWorldSpace=*/true, /*bMarkRenderStateDirty=*/true, /*bTeleport=*/true);
+	}
+}
+
+bool ACourseLayoutActor::ExportWorld(UWorld* World, const FString& Path, int32& OutPlatforms, int32& OutLedges)
+{
+	OutPlatforms = 0;
+	OutLedges = 0;
+	if (!World) return false;
+
+	std::vector<GameplayMath::FCourseLayoutMesh> Meshes;
+	std::vector<GameplayMath::FCourseLayoutPlatform> Platforms;
+	std::vector<GameplayMath::FCourseLayoutLedge> Ledges;
+	TMap<FString, uint32> MeshIndices;
+
+	for (TActorIterator<AMovingPlatform> It(World); It; ++It)
+	{
+		const AMovingPlatform* Actor = *It;
+		const UStaticMeshComponent* MeshComponent = Actor->FindComponentByClass<UStaticMeshComponent>();
+		if (!MeshComponent || !MeshComponent->GetStaticMesh()) continue;
+
+		// 플레이 전(에디터 월드)에 내보내면 시작 상태가 그대로 들어감
+		const FVector Offset = MeshComponent->GetComponentLocation() - Actor->GetActorLocation();
+		const FVector Start = (Actor->HasActorBegunPlay() ? Actor->StartLocation : Actor->GetActorLocation()) + Offset;
+
+		GameplayMath::FCourseLayoutPlatform Platform = {};
+		CourseLayout::ToFloat3(Start, Platform.StartLocation);
+		CourseLayout::ToFloat3(Actor->PlatformVelocity, Platform.Velocity);
+		Platform.MoveDistance = Actor->MoveDistance;
+		CourseLayout::ToFloat3(MeshComponent->GetComponentRotation(), Platform.Rotation);
+		CourseLayout::ToFloat3(Actor->RotationVelocity, Platform.RotationVelocity);
+		CourseLayout::ToFloat3(MeshComponent->GetComponentScale(), Platform.Scale);
+		Platform.MeshIndex = CourseLayout::AddMesh(Meshes, MeshIndices, MeshComponent->GetStaticMesh()->GetPathName());
+		Platforms.push_back(Platform);
+	}
+
+	static const FName ClimbableTag(TEXT("Climbable"));
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		const AActor* Actor = *It;
+		if (Actor->IsA<AMovingPlatform>() || Actor->IsA<ACourseLayoutActor>() || !Actor->ActorHasTag(ClimbableTag)) continue;
+
+		TInlineComponentArray<UStaticMeshComponent*> MeshComponents(Actor);
+		for (const UStaticMeshComponent* MeshComponent : MeshComponents)
+		{
+			if (!MeshComponent->GetStaticMesh()) continue;
+
+			GameplayMath::FCourseLayoutLedge Ledge = {};
+			CourseLayout::ToFloat3(MeshComponent->GetComponentLocation(), Ledge.Location);
+			CourseLayout::ToFloat3(MeshComponent->GetComponentRotation(), Ledge.Rotation);
+			CourseLayout::ToFloat3(MeshComponent->GetComponentScale(), Ledge.Scale);
+			Ledge.MeshIndex = CourseLayout::AddMesh(Meshes, MeshIndices, MeshComponent->GetStaticMesh()->GetPathName());
+			Ledges.push_back(Ledge);
+		}
+	}
+
+	if (!CourseLayout::SaveBytes(GameplayMath::SerializeCourseLayout(Meshes, Platforms, Ledges), Path))
+	{
+		UE_LOG(LogObstacleAssualt, Warning, TEXT("CourseLayout: failed to write %s"), *Path);
+		return false;
+	}
+
+	OutPlatforms = (int32)Platforms.size();
+	OutLedges = (int32)Ledges.size();
+	return true;
+}
+
+bool ACourseLayoutActor::WriteSynthetic(const FString& Path, int32 NumPlatforms)
+{
+	FRandomStream Random(1234);
+
+	std::vector<GameplayMath::FCourseLayoutMesh> Meshes;
+	TMap<FString, uint32> MeshIndices;
+	const uint32 CubeIndex = CourseLayout::AddMesh(Meshes, MeshIndices, TEXT("/Engine/BasicShapes/Cube.Cube"));
+
+	const int32 Columns = FMath::Max(1, FMath::CeilToInt(FMath::Sqrt((float)NumPlatforms)));
+	const float Spacing = 800.f;
+
+	std::vector<GameplayMath::FCourseLayoutPlatform> Platforms(NumPlatforms);
+	for (int32 i = 0; i < NumPlatforms; ++i)
+	{
+		GameplayMath::FCourseLayoutPlatform& Platform = Platforms[i];
+		Platform = {};
+
+		const FVector Start((i % Columns) * Spacing, (i / Columns) * Spacing, Random.FRandRange(0.f, 2000.f));
+		CourseLayout::ToFloat3(Start, Platform.StartLocation);
+		CourseLayout::ToFloat3(Random.GetUnitVector() * Random.FRandRange(100.f, 400.f), Platform.Velocity);
+		Platform.MoveDistance = Random.FRandRange(200.f, 600.f);
+		CourseLayout::ToFloat3(FRotator(0.f, Random.FRandRange(0.f, 360.f), 0.f), Platform.Rotation);
+		CourseLayout::ToFloat3(FRotator(0.f, Random.FRand() < 0.25f ? Random.FRandRange(-90.f, 90.f) : 0.f, 0.f), Platform.RotationVelocity);
+		CourseLayout::ToFloat3(FVector(2.f, 2.f, 0.25f), Platform.Scale);
+		Platform.MeshIndex = CubeIndex;
+	}
+
+	std::vector<GameplayMath::FCourseLayoutLedge> Ledges(NumPlatforms / 10);
+	for (size_t i = 0; i < Ledges.size(); ++i)
+	{
+		GameplayMath::FCourseLayoutLedge& Ledge = Ledges[i];
+		Ledge = {};
+
+		const int32 Cell = Random.RandHelper(NumPlatforms);
+		CourseLayout::ToFloat3(FVector((Cell % Columns) * Spacing + Spacing * 0.5f, (Cell / Columns) * Spacing, 100.f), Ledge.Location);
+		CourseLayout::ToFloat3(FRotator::ZeroRotator, Ledge.Rotation);
+		CourseLayout::ToFloat3(FVector(1.f, 3.f, 2.f), Ledge.Scale);
+		Ledge.MeshIndex = CubeIndex;
+	}
+
+	if (!CourseLayout::SaveBytes(GameplayMath::SerializeCourseLayout(Meshes, Platforms, Ledges), Path))
+	{
+		UE_LOG(LogObstacleAssualt, Warning, TEXT("CourseLayout: failed to write %s"), *Path);
+		return false;
+	}
+	return true;
+}
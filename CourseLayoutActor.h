@@ -0,0 +1,122 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "GameplayMath/CourseLayout.h"
+#include "CourseLayoutActor.generated.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+class UInstancedStaticMeshComponent;
+class UStaticMeshComponent;
+
+/**
+ *  코스 레이아웃(.oacl)을 메모리 매핑해서 발판/레지를 인스턴스로 그리는 액터
+ *  발판마다 액터를 만들지 않고, 매핑된 레코드에서 월드 시간으로 위치를 바로 계산해
+ *  메시별 인스턴스 컴포넌트를 일괄 갱신한다. 레지 컴포넌트에는 Climbable 태그가 붙는다.
+ *  내보내기/생성: oa.CourseLayout.Export, oa.CourseLayout.Generate
+ *
+ *  인스턴스 컴포넌트 자체는 움직이지 않으므로 CharacterMovement 가 그 위에 선 러너를 태워 가지 못한다.
+ *  그래서 움직이는 발판 인스턴스는 렌더만 하고, 러너 근처의 움직이는 발판에만 풀에서 꺼낸
+ *  충돌 전용 컴포넌트를 붙여 발판과 함께 실제로 이동시킨다 (AMovingPlatform 과 같은 베이스 이동).
+ */
+UCLASS()
+class OBSTACLEASSUALT_API ACourseLayoutActor : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	ACourseLayoutActor();
+
+	/** BeginPlay에서 읽을 파일 (상대 경로면 프로젝트 디렉터리 기준) */
+	UPROPERTY(EditAnywhere, Category = "Layout")
+	FString LayoutFile;
+
+	/** 레지 인스턴스 컴포넌트 태그 (캐릭터의 ClimbableTag 와 맞춤) */
+	UPROPERTY(EditAnywhere, Category = "Layout")
+	FName ClimbableTag = TEXT("Climbable");
+
+	/** 움직이는 발판에 러너 근처 충돌 프록시를 붙일지 (끄면 움직이는 발판은 렌더만, 부하 측정용) */
+	UPROPERTY(EditAnywhere, Category = "Layout")
+	bool bMovingPlatformCollision = true;
+
+	/** 러너에서 이 거리 안의 움직이는 발판에 충돌 프록시를 붙임 (1.25배 밖으로 멀어지면 반납) */
+	UPROPERTY(EditAnywhere, Category = "Layout", meta = (EditCondition = "bMovingPlatformCollision", ClampMin = "0.0"))
+	float CollisionProxyRadius = 2000.f;
+
+	/** 충돌 프록시 풀 상한 */
+	UPROPERTY(EditAnywhere, Category = "Layout", meta = (EditCondition = "bMovingPlatformCollision", ClampMin = "1"))
+	int32 MaxCollisionProxies = 64;
+
+	/** 파일을 매핑하고 인스턴스를 만든다. 이전 레이아웃은 내린다 */
+	bool LoadLayout(const FString& Path);
+	void UnloadLayout();
+
+	int32 GetNumPlatforms() const { return (int32)View.NumPlatforms; }
+	int32 GetNumLedges() const { return (int32)View.NumLedges; }
+
+	virtual void Tick(float DeltaSeconds) override;
+
+	/** 월드의 AMovingPlatform / Climbable 액터를 레이아웃 파일로 내보낸다 */
+	static bool ExportWorld(UWorld* World, const FString& Path, int32& OutPlatforms, int32& OutLedges);
+
+	/** 부하 측정용 합성 코스 (격자 배치, 레지는 발판 수의 1/10) */
+	static bool WriteSynthetic(const FString& Path, int32 NumPlatforms);
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+	UInstancedStaticMeshComponent* CreateMeshComponent(uint32 MeshIndex, bool bLedge, bool bCollision);
+
+	/** 숨긴 충돌 전용 컴포넌트 (렌더는 인스턴스가 담당) */
+	UStaticMeshComponent* CreateCollisionProxy();
+
+	/** 움직이는 발판 하나의 프록시를 붙이거나/옮기거나/반납 */
+	void UpdateCollisionProxy(int32 MeshIndex, int32 MovingIndex, const FTransform& Transform);
+	void ReleaseCollisionProxy(int32 Slot);
+
+	/** 이번 틱의 러너 위치 (풀 대기 폰 제외) */
+	void GatherRunnerLocations();
+
+	/** 레코드의 Time 초 시점 월드 트랜스폼 */
+	static FTransform EvaluatePlatform(const GameplayMath::FCourseLayoutPlatform& Platform, double Time);
+
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+	TUniquePtr<IMappedFileHandle> MappedFile;
+
+	/** 매핑을 지원하지 않는 플랫폼에서만 사용 */
+	TArray64<uint8> FallbackBytes;
+
+	GameplayMath::FCourseLayoutView View;
+
+	/** 메시 인덱스별 인스턴스 컴포넌트 (정지 발판, 충돌 있음) */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UInstancedStaticMeshComponent>> PlatformComponents;
+
+	/** 메시 인덱스별 움직이는 발판 인스턴스 (렌더만) */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UInstancedStaticMeshComponent>> MovingComponents;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UInstancedStaticMeshComponent>> LedgeComponents;
+
+	/** 메시별 움직이는 발판 레코드 인덱스 (인스턴스 0..N-1 과 같은 순서) */
+	TArray<TArray<int32>> MovingByMesh;
+
+	/** MovingByMesh 와 같은 모양. 붙은 충돌 프록시 슬롯 (INDEX_NONE = 없음) */
+	TArray<TArray<int32>> MovingProxySlots;
+
+	/** 충돌 프록시 풀과 슬롯별 주인 (MeshIndex, MovingIndex). 빈 슬롯은 MeshIndex 가 INDEX_NONE */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UStaticMeshComponent>> CollisionProxies;
+	TArray<FIntPoint> ProxyOwners;
+
+	TArray<FVector> RunnerLocations;
+	bool bWarnedProxyPoolFull = false;
+
+	TArray<FTransform> ScratchTransforms;
+
+	double LayoutStartSeconds = 0.0;
+};
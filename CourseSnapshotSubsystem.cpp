@@ -0,0 +1,71 @@
+#include "CourseSnapshotSubsystem.h"
+#include "SplinePathPlatform.h"
+#include "EngineUtils.h"
+#include "Engine/World.h"
+#include "ObstacleAssualt.h"
+
+bool UCourseSnapshotSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UCourseSnapshotSubsystem::CaptureCourse(FCourseSnapshot& OutSnapshot) const
+{
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	OutSnapshot.Platforms.Reset();
+	OutSnapshot.PlatformPhases.Reset();
+	for (TActorIterator<AMovingPlatform> It(World); It; ++It)
+	{
+		OutSnapshot.Platforms.Add(*It);
+		It->CapturePhase(OutSnapshot.PlatformPhases.AddUninitialized_GetRef());
+	}
+
+	OutSnapshot.PathPlatforms.Reset();
+	OutSnapshot.PathStates.Reset();
+	for (TActorIterator<ASplinePathPlatform> It(World); It; ++It)
+	{
+		OutSnapshot.PathPlatforms.Add(*It);
+		OutSnapshot.PathStates.Add(It->GetPathState());
+	}
+
+	OutSnapshot.bValid = true;
+
+	UE_LOG(LogObstacleAssualt, Verbose, TEXT("CourseSnapshot: captured %d platforms, %d path platforms (%d bytes) in %.3f ms"),
+		OutSnapshot.Platforms.Num(), OutSnapshot.PathPlatforms.Num(), OutSnapshot.GetBytes(), FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles));
+}
+
+void UCourseSnapshotSubsystem::RestoreCourse(const FCourseSnapshot& Snapshot) const
+{
+	if (!Snapshot.bValid) return;
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	for (int32 i = 0; i < Snapshot.Platforms.Num(); ++i)
+	{
+		if (AMovingPlatform* Platform = Snapshot.Platforms[i].Get())
+		{
+			Platform->RestorePhase(Snapshot.PlatformPhases[i]);
+		}
+	}
+
+	for (int32 i = 0; i < Snapshot.PathPlatforms.Num(); ++i)
+	{
+		if (ASplinePathPlatform* Platform = Snapshot.PathPlatforms[i].Get())
+		{
+			Platform->RestorePathState(Snapshot.PathStates[i]);
+		}
+	}
+
+	UE_LOG(LogObstacleAssualt, Verbose, TEXT("CourseSnapshot: restored %d platforms in %.3f ms"),
+		Snapshot.Platforms.Num() + Snapshot.PathPlatforms.Num(), FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles));
+}
+
+int32 FCourseSnapshot::GetBytes() const
+{
+	return PlatformPhases.Num() * (sizeof(FMovingPlatformPhase) + sizeof(TWeakObjectPtr<AMovingPlatform>))
+		+ PathStates.Num() * (sizeof(FSplinePathState) + sizeof(TWeakObjectPtr<ASplinePathPlatform>));
+}
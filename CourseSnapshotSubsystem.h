@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MovingPlatform.h"
+#include "SplinePathEvaluators.h"
+#include "CourseSnapshotSubsystem.generated.h"
+
+class ASplinePathPlatform;
+
+/** 한 시점의 모든 발판 위상 (체크포인트마다 하나, FRunnerSnapshot 이 보관) */
+struct FCourseSnapshot
+{
+	TArray<TWeakObjectPtr<AMovingPlatform>> Platforms;
+	TArray<FMovingPlatformPhase> PlatformPhases;
+
+	TArray<TWeakObjectPtr<ASplinePathPlatform>> PathPlatforms;
+	TArray<FSplinePathState> PathStates;
+
+	bool bValid = false;
+
+	/** 스냅샷 크기 (바이트) */
+	int32 GetBytes() const;
+};
+
+/**
+ *  코스(발판) 상태 스냅샷
+ *  체크포인트 시점에 모든 발판의 위상을 압축 배열로 저장하고,
+ *  리스폰 시 액터 생성/파괴 없이 같은 프레임 안에서 제자리 복원한다.
+ *  스냅샷은 러너 상태와 함께 각 러너의 체크포인트가 보관한다 (AObstacleAssualtCharacter::SaveCheckpoint).
+ */
+UCLASS()
+class OBSTACLEASSUALT_API UCourseSnapshotSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** 모든 발판 위상을 OutSnapshot 에 저장 (이전 내용 덮어씀, 배열 용량은 재사용) */
+	void CaptureCourse(FCourseSnapshot& OutSnapshot) const;
+
+	/** 스냅샷으로 모든 발판 복원 */
+	void RestoreCourse(const FCourseSnapshot& Snapshot) const;
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+};
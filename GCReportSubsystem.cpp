@@ -0,0 +1,209 @@
+#include "GCReportSubsystem.h"
+#include "CourseLayoutActor.h"
+#include "MovingPlatform.h"
+#include "ObstacleAssualtCharacter.h"
+#include "PlaytimeWidget.h"
+#include "SplinePathPlatform.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "ObstacleAssualt.h"
+#include "UObject/UObjectArray.h"
+#include "UObject/UObjectIterator.h"
+
+static TAutoConsoleVariable<int32> CVarGCClusterCourse(
+	TEXT("oa.GC.ClusterCourse"),
+	1,
+	TEXT("코스 발판 액터를 레벨 GC 클러스터에 넣을지 (레벨 로드 때 읽힘, 비교 측정용으로 0)"),
+	ECVF_ReadOnly);
+
+static FAutoConsoleCommandWithWorld GCReportCommand(
+	TEXT("oa.GC.Report"),
+	TEXT("GC 패스 시간, 검사 대상 오브젝트 수, 코스/런 오브젝트 구성 출력"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (const UGCReportSubsystem* Report = World ? World->GetSubsystem<UGCReportSubsystem>() : nullptr)
+		{
+			UE_LOG(LogObstacleAssualt, Display, TEXT("%s"), *Report->DescribeStats());
+			UE_LOG(LogObstacleAssualt, Display, TEXT("%s"), *Report->DescribeCourseObjects());
+		}
+	}));
+
+// 전체 GC를 여러 번 강제로 돌려 평균 패스 시간 측정 (클러스터 켜고/끄고 비교)
+// 사용법: oa.GC.Measure [Passes]
+static FAutoConsoleCommandWithWorldAndArgs GCMeasureCommand(
+	TEXT("oa.GC.Measure"),
+	TEXT("전체 GC를 N번 (기본 5) 돌려 평균 패스 시간과 검사 대상 수 출력"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		const int32 Passes = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 5;
+
+		double TotalMs = 0.0;
+		double WorstMs = 0.0;
+		for (int32 i = 0; i < Passes; ++i)
+		{
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, /*bFullPurge=*/true);
+			const double Ms = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+			TotalMs += Ms;
+			WorstMs = FMath::Max(WorstMs, Ms);
+		}
+
+		const FGCPassStats Counts = UGCReportSubsystem::CaptureObjectCounts();
+		UE_LOG(LogObstacleAssualt, Display, TEXT("oa.GC.Measure: %d passes, avg %.2f ms, worst %.2f ms | %d objects, %d scanned, %d clustered in %d clusters, %d disregarded | course clustering %s"),
+			Passes, TotalMs / Passes, WorstMs, Counts.NumObjects, Counts.NumScanned, Counts.NumClustered, Counts.NumClusters, Counts.NumDisregarded,
+			UGCReportSubsystem::ShouldClusterCourseContent() ? TEXT("on") : TEXT("off"));
+	}));
+
+namespace
+{
+	/** 오브젝트가 클러스터 안에 있는지 (루트 포함) */
+	bool IsInGCCluster(const UObject* Object)
+	{
+		const FUObjectItem* Item = GUObjectArray.ObjectToObjectItem(Object);
+		return Item && (Item->GetOwnerIndex() != 0 || Item->HasAnyFlags(EInternalObjectFlags::ClusterRoot));
+	}
+
+	/** 액터 클래스 하나의 액터/컴포넌트 수와 그중 클러스터에 든 수 */
+	struct FCourseObjectCount
+	{
+		int32 Actors = 0;
+		int32 Components = 0;
+		int32 Clustered = 0;
+	};
+
+	template <typename TActor>
+	FCourseObjectCount CountCourseActors(UWorld* World)
+	{
+		FCourseObjectCount Count;
+		TInlineComponentArray<UActorComponent*> Components;
+		for (TActorIterator<TActor> It(World); It; ++It)
+		{
+			++Count.Actors;
+			Count.Clustered += IsInGCCluster(*It) ? 1 : 0;
+
+			Components.Reset();
+			It->GetComponents(Components);
+			Count.Components += Components.Num();
+			for (const UActorComponent* Component : Components)
+			{
+				Count.Clustered += IsInGCCluster(Component) ? 1 : 0;
+			}
+		}
+		return Count;
+	}
+}
+
+bool UGCReportSubsystem::ShouldClusterCourseContent()
+{
+	return CVarGCClusterCourse.GetValueOnAnyThread() != 0;
+}
+
+FGCPassStats UGCReportSubsystem::CaptureObjectCounts()
+{
+	FGCPassStats Stats;
+	Stats.NumObjects = GUObjectArray.GetObjectArrayNumMinusAvailable();
+	Stats.NumDisregarded = GUObjectArray.GetFirstGCIndex();
+
+	for (const FUObjectCluster& Cluster : GUObjectClusters.GetClustersUnsafe())
+	{
+		// 해제된 슬롯은 RootIndex 가 INDEX_NONE
+		if (Cluster.RootIndex == INDEX_NONE) continue;
+
+		++Stats.NumClusters;
+		Stats.NumClustered += Cluster.Objects.Num();
+	}
+
+	Stats.NumScanned = FMath::Max(0, Stats.NumObjects - Stats.NumDisregarded - Stats.NumClustered);
+	return Stats;
+}
+
+bool UGCReportSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UGCReportSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PreGCHandle = FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddUObject(this, &UGCReportSubsystem::OnPreGarbageCollect);
+	PostGCHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &UGCReportSubsystem::OnPostGarbageCollect);
+}
+
+void UGCReportSubsystem::Deinitialize()
+{
+	FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Remove(PreGCHandle);
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGCHandle);
+
+	Super::Deinitialize();
+}
+
+void UGCReportSubsystem::OnPreGarbageCollect()
+{
+	// 구성은 패스 전에 센다 (수집 후에는 이번에 지운 오브젝트가 빠져 있음)
+	PendingPass = CaptureObjectCounts();
+	PassStartCycles = FPlatformTime::Cycles64();
+}
+
+void UGCReportSubsystem::OnPostGarbageCollect()
+{
+	if (PassStartCycles == 0) return;
+
+	PendingPass.Ms = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - PassStartCycles);
+	PassStartCycles = 0;
+
+	LastPass = PendingPass;
+	if (LastPass.Ms > WorstPass.Ms)
+	{
+		WorstPass = LastPass;
+	}
+	++NumPasses;
+	TotalMs += LastPass.Ms;
+
+	UE_LOG(LogObstacleAssualt, Verbose, TEXT("GC pass: %.2f ms, %d objects, %d scanned"), LastPass.Ms, LastPass.NumObjects, LastPass.NumScanned);
+}
+
+FString UGCReportSubsystem::DescribeStats() const
+{
+	return FString::Printf(TEXT("GC: %d passes, avg %.2f ms | last %.2f ms (%d objects, %d scanned, %d clustered in %d clusters, %d disregarded) | worst %.2f ms (%d scanned)"),
+		NumPasses, NumPasses > 0 ? TotalMs / NumPasses : 0.0,
+		LastPass.Ms, LastPass.NumObjects, LastPass.NumScanned, LastPass.NumClustered, LastPass.NumClusters, LastPass.NumDisregarded,
+		WorstPass.Ms, WorstPass.NumScanned);
+}
+
+FString UGCReportSubsystem::DescribeCourseObjects() const
+{
+	UWorld* World = GetWorld();
+	if (!World) return FString();
+
+	const FCourseObjectCount Moving = CountCourseActors<AMovingPlatform>(World);
+	const FCourseObjectCount Spline = CountCourseActors<ASplinePathPlatform>(World);
+	const FCourseObjectCount Layout = CountCourseActors<ACourseLayoutActor>(World);
+
+	// 런마다 (재)생성되는 표시용 오브젝트. 러너와 수명이 같으므로 클러스터에 넣지 않고 따로 센다
+	int32 RunMIDs = 0;
+	for (TObjectIterator<UMaterialInstanceDynamic> It; It; ++It)
+	{
+		if (It->GetWorld() == World && It->GetOuter() && It->GetOuter()->IsA<AObstacleAssualtCharacter>())
+		{
+			++RunMIDs;
+		}
+	}
+	int32 RunWidgets = 0;
+	for (TObjectIterator<UPlaytimeWidget> It; It; ++It)
+	{
+		if (It->GetWorld() == World)
+		{
+			++RunWidgets;
+		}
+	}
+
+	return FString::Printf(TEXT("Course objects: moving platforms %d actors + %d components (%d clustered) | spline platforms %d + %d (%d clustered) | layouts %d + %d (%d clustered) | per-run: %d MIDs, %d playtime widgets | course clustering %s"),
+		Moving.Actors, Moving.Components, Moving.Clustered,
+		Spline.Actors, Spline.Components, Spline.Clustered,
+		Layout.Actors, Layout.Components, Layout.Clustered,
+		RunMIDs, RunWidgets,
+		ShouldClusterCourseContent() ? TEXT("on") : TEXT("off"));
+}
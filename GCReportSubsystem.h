@@ -0,0 +1,79 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GCReportSubsystem.generated.h"
+
+/** GC 한 번의 비용과 그때의 UObject 구성 */
+struct FGCPassStats
+{
+	/** 도달성 분석 + 수집 시간 (점진적 purge 제외) */
+	double Ms = 0.0;
+
+	/** 살아 있는 UObject 전체 */
+	int32 NumObjects = 0;
+
+	/** 디스리가드 풀 (엔진 시작 시 오브젝트, 검사 안 함) */
+	int32 NumDisregarded = 0;
+
+	/** 클러스터 루트가 아닌 클러스터 멤버 (루트 하나로 한꺼번에 판정되어 개별 검사 안 함) */
+	int32 NumClustered = 0;
+
+	int32 NumClusters = 0;
+
+	/** 도달성 분석이 하나씩 보는 오브젝트 수 */
+	int32 NumScanned = 0;
+};
+
+/**
+ *  GC 비용 보고
+ *  모든 GC 패스의 시간과 검사 대상 오브젝트 수를 기록하고,
+ *  코스 콘텐츠(발판/레이아웃)가 클러스터에 들어갔는지와 런마다 만드는 표시용 오브젝트(MID/위젯)를 따로 센다.
+ *  콘솔: oa.GC.Report, oa.GC.Measure [Passes]
+ *
+ *  코스 발판은 레벨과 수명이 같으므로 레벨 GC 클러스터에 넣는다 (oa.GC.ClusterCourse).
+ *  클러스터는 쿠킹된 레벨 로드 때 만들어지므로 PIE나 런타임 스폰 발판에는 적용되지 않는다.
+ */
+UCLASS()
+class OBSTACLEASSUALT_API UGCReportSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** 코스 액터가 bCanBeInCluster 를 켤지 (레벨 로드 때 읽히므로 시작 인자로 지정: -dpcvars=oa.GC.ClusterCourse=0) */
+	static bool ShouldClusterCourseContent();
+
+	/** 지금 UObject 구성 (시간 제외) */
+	static FGCPassStats CaptureObjectCounts();
+
+	/** 마지막/최악 패스, 패스 수와 평균 */
+	FString DescribeStats() const;
+
+	/** 코스 콘텐츠와 런마다 만드는 오브젝트 구성 */
+	FString DescribeCourseObjects() const;
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	void OnPreGarbageCollect();
+	void OnPostGarbageCollect();
+
+	FGCPassStats LastPass;
+	FGCPassStats WorstPass;
+	int32 NumPasses = 0;
+	double TotalMs = 0.0;
+
+	/** 진행 중인 패스 (Pre에서 채우고 Post에서 닫음) */
+	FGCPassStats PendingPass;
+	uint64 PassStartCycles = 0;
+
+	FDelegateHandle PreGCHandle;
+	FDelegateHandle PostGCHandle;
+};
@@ -0,0 +1,275 @@
+// GameplayMath 마이크로벤치마크 (엔진 없이 빌드, GameplayMath/CMakeLists.txt)
+//
+//   GameplayMathBench [--iterations N] [--repeats N] [--json out.json] [--baseline base.json] [--tolerance 0.25]
+//
+// 커널마다 ns/op (여러 번 반복 중 최솟값)을 출력한다. --baseline 을 주면
+// 이전 커밋에서 저장한 결과와 비교해서 허용치보다 느려진 커널이 있으면 1로 끝난다.
+
+// 엔진 모듈 안에서는 UBT가 이 파일도 모으므로 main 은 엔진 밖에서만
+#if !defined(WITH_ENGINE)
+
+#include "../GameplayMath.h"
+#include "../CourseLayout.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace GameplayMath;
+
+namespace
+{
+	/** 최적화로 결과가 지워지지 않게 누적 */
+	volatile double GSink = 0.0;
+
+	struct FResult
+	{
+		std::string Name;
+		double NsPerOp = 0.0;
+	};
+
+	/** 같은 입력 세트를 Repeats 번 돌려 가장 빠른 회차의 ns/op */
+	template <typename TBody>
+	FResult Measure(const char* Name, int Iterations, int Repeats, TBody&& Body)
+	{
+		double Best = 1e30;
+		for (int Repeat = 0; Repeat < Repeats; ++Repeat)
+		{
+			const auto Start = std::chrono::steady_clock::now();
+			double Acc = 0.0;
+			for (int i = 0; i < Iterations; ++i)
+			{
+				Acc += Body(i);
+			}
+			const auto End = std::chrono::steady_clock::now();
+			GSink = GSink + Acc;
+
+			const double Ns = std::chrono::duration<double, std::nano>(End - Start).count() / Iterations;
+			Best = Ns < Best ? Ns : Best;
+		}
+		return FResult{ Name, Best };
+	}
+
+	/** 입력 다양성을 위한 간단한 LCG (실행마다 같은 값) */
+	struct FRandom
+	{
+		uint32_t State = 12345u;
+		double Next(double Min, double Max)
+		{
+			State = State * 1664525u + 1013904223u;
+			return Min + (Max - Min) * ((State >> 8) * (1.0 / 16777216.0));
+		}
+	};
+
+	std::map<std::string, double> ReadJson(const std::string& Path)
+	{
+		// 이 프로그램이 쓴 형식만 읽음: { "Name": 1.23, ... }
+		std::map<std::string, double> Values;
+		std::ifstream In(Path);
+		std::stringstream Text;
+		Text << In.rdbuf();
+		const std::string Data = Text.str();
+
+		size_t Pos = 0;
+		while ((Pos = Data.find('"', Pos)) != std::string::npos)
+		{
+			const size_t NameEnd = Data.find('"', Pos + 1);
+			const size_t Colon = Data.find(':', NameEnd);
+			if (NameEnd == std::string::npos || Colon == std::string::npos) break;
+
+			Values[Data.substr(Pos + 1, NameEnd - Pos - 1)] = std::strtod(Data.c_str() + Colon + 1, nullptr);
+			Pos = Colon + 1;
+		}
+		return Values;
+	}
+
+	void WriteJson(const std::string& Path, const std::vector<FResult>& Results)
+	{
+		std::ofstream Out(Path);
+		Out << "{\n";
+		for (size_t i = 0; i < Results.size(); ++i)
+		{
+			char Line[128];
+			std::snprintf(Line, sizeof(Line), "  \"%s\": %.3f%s\n", Results[i].Name.c_str(), Results[i].NsPerOp, i + 1 < Results.size() ? "," : "");
+			Out << Line;
+		}
+		Out << "}\n";
+	}
+}
+
+int main(int argc, char** argv)
+{
+	int Iterations = 1 << 20;
+	int Repeats = 7;
+	double Tolerance = 0.25;
+	std::string JsonPath;
+	std::string BaselinePath;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const bool bHasValue = i + 1 < argc;
+		if (!std::strcmp(argv[i], "--iterations") && bHasValue) Iterations = std::atoi(argv[++i]);
+		else if (!std::strcmp(argv[i], "--repeats") && bHasValue) Repeats = std::atoi(argv[++i]);
+		else if (!std::strcmp(argv[i], "--json") && bHasValue) JsonPath = argv[++i];
+		else if (!std::strcmp(argv[i], "--baseline") && bHasValue) BaselinePath = argv[++i];
+		else if (!std::strcmp(argv[i], "--tolerance") && bHasValue) Tolerance = std::atof(argv[++i]);
+		else
+		{
+			std::fprintf(stderr, "usage: %s [--iterations N] [--repeats N] [--json out.json] [--baseline base.json] [--tolerance 0.25]\n", argv[0]);
+			return 2;
+		}
+	}
+	if (Iterations < 1) Iterations = 1;
+	if (Repeats < 1) Repeats = 1;
+
+	// 입력은 미리 만들어 두고 측정 구간에서는 커널만 돈다
+	constexpr int NumInputs = 1024;
+	FRandom Random;
+	std::vector<FVec3> Locations(NumInputs), Normals(NumInputs), Velocities(NumInputs);
+	std::vector<double> Yaws(NumInputs), Heights(NumInputs);
+	std::vector<float> Seconds(NumInputs);
+	for (int i = 0; i < NumInputs; ++i)
+	{
+		Locations[i] = FVec3(Random.Next(-1e5, 1e5), Random.Next(-1e5, 1e5), Random.Next(0, 5e3));
+		Normals[i] = SafeNormal(FVec3(Random.Next(-1, 1), Random.Next(-1, 1), Random.Next(-0.5, 0.5)));
+		Velocities[i] = FVec3(Random.Next(-600, 600), Random.Next(-600, 600), Random.Next(-600, 600));
+		Yaws[i] = Random.Next(-180, 180);
+		Heights[i] = Locations[i].Z + Random.Next(0, 250);
+		Seconds[i] = (float)Random.Next(0, 20000);
+	}
+	constexpr int Mask = NumInputs - 1;
+
+	std::vector<FResult> Results;
+
+	{
+		std::vector<FPingPongState> Platforms(NumInputs);
+		for (int i = 0; i < NumInputs; ++i)
+		{
+			Platforms[i].Location = Platforms[i].StartLocation = Locations[i];
+			Platforms[i].Velocity = Velocities[i];
+		}
+		Results.push_back(Measure("StepPingPong", Iterations, Repeats, [&](int i)
+		{
+			double Overshoot;
+			FPingPongState& State = Platforms[i & Mask];
+			StepPingPong(State, 400.0, 1.0 / 60.0, Overshoot);
+			return State.Location.X + Overshoot;
+		}));
+	}
+
+	{
+		std::vector<FPingPongState> Platforms(NumInputs);
+		for (int i = 0; i < NumInputs; ++i)
+		{
+			Platforms[i].Location = Platforms[i].StartLocation = Locations[i];
+			Platforms[i].Velocity = Velocities[i];
+		}
+		Results.push_back(Measure("AdvancePingPong", Iterations, Repeats, [&](int i)
+		{
+			const int k = i & Mask;
+			return AdvancePingPong(Platforms[k], 400.0, Seconds[k]).Location.X;
+		}));
+	}
+
+	Results.push_back(Measure("EvaluatePingPongAt", Iterations, Repeats, [&](int i)
+	{
+		const int k = i & Mask;
+		return EvaluatePingPongAt(Locations[k], Velocities[k], 400.0, Seconds[k]).X;
+	}));
+
+	Results.push_back(Measure("ComputeWallProbe", Iterations, Repeats, [&](int i)
+	{
+		FVec3 Start, End;
+		ComputeWallProbe(Locations[i & Mask], Yaws[i & Mask], 96.0, 42.0, 70.0, Start, End);
+		return End.X + Start.Z;
+	}));
+
+	Results.push_back(Measure("LedgeClassify", Iterations, Repeats, [&](int i)
+	{
+		const int k = i & Mask;
+		FVec3 Start, End;
+		ComputeTopProbe(Locations[k], Normals[k], 90.0, 120.0, Start, End);
+		const bool bWall = IsWallNormal(Normals[k]);
+		const bool bInRange = IsLedgeHeightInRange(Heights[k], Locations[k].Z, 96.0, 60.0, 180.0);
+		return End.Z + (bWall ? 1.0 : 0.0) + (bInRange ? 2.0 : 0.0);
+	}));
+
+	{
+		FAutoClimbParams Params;
+		Params.bRequireAirborne = false;
+		Results.push_back(Measure("EvaluateAutoClimb", Iterations, Repeats, [&](int i)
+		{
+			const int k = i & Mask;
+			FAutoClimbInput Input;
+			Input.Now = 10.0 + k;
+			Input.bFalling = true;
+			Input.Forward = SafeNormal(Velocities[k]);
+			Input.WallNormal = Normals[k];
+			Input.Velocity = Velocities[k];
+			double Approach;
+			return (double)EvaluateAutoClimb(Params, Input, Approach) + Approach;
+		}));
+	}
+
+	Results.push_back(Measure("ComputeHangPose", Iterations, Repeats, [&](int i)
+	{
+		const int k = i & Mask;
+		const FHangPose Pose = ComputeHangPose(Locations[k], Normals[k], 35.0, -40.0, 96.0);
+		const FVec3 Target = ComputeClimbUpTarget(Locations[k], Normals[k], 30.0, 96.0);
+		return Pose.Location.X + Pose.YawDegrees + Target.Z;
+	}));
+
+	Results.push_back(Measure("FormatPlaytime", Iterations, Repeats, [&](int i)
+	{
+		char Buffer[16];
+		return (double)FormatPlaytime(PlaytimeWholeSeconds(Seconds[i & Mask]), Buffer, sizeof(Buffer)) + Buffer[0];
+	}));
+
+	std::map<std::string, double> Baseline;
+	if (!BaselinePath.empty())
+	{
+		Baseline = ReadJson(BaselinePath);
+		if (Baseline.empty())
+		{
+			std::fprintf(stderr, "baseline %s is missing or empty\n", BaselinePath.c_str());
+			return 2;
+		}
+	}
+
+	int Regressions = 0;
+	std::printf("%-20s %10s %10s %8s\n", "kernel", "ns/op", "baseline", "delta");
+	for (const FResult& Result : Results)
+	{
+		const auto It = Baseline.find(Result.Name);
+		if (It == Baseline.end())
+		{
+			std::printf("%-20s %10.3f %10s %8s\n", Result.Name.c_str(), Result.NsPerOp, "-", "-");
+			continue;
+		}
+
+		const double Delta = It->second > 0.0 ? Result.NsPerOp / It->second - 1.0 : 0.0;
+		const bool bRegressed = Delta > Tolerance;
+		Regressions += bRegressed ? 1 : 0;
+		std::printf("%-20s %10.3f %10.3f %+7.1f%%%s\n", Result.Name.c_str(), Result.NsPerOp, It->second, Delta * 100.0, bRegressed ? "  REGRESSION" : "");
+	}
+
+	if (!JsonPath.empty())
+	{
+		WriteJson(JsonPath, Results);
+	}
+
+	if (Regressions > 0)
+	{
+		std::printf("%d kernel(s) slower than baseline by more than %.0f%%\n", Regressions, Tolerance * 100.0);
+		return 1;
+	}
+	return 0;
+}
+
+#endif // !WITH_ENGINE
@@ -0,0 +1,113 @@
+#include "CourseLayout.h"
+
+#include <cmath>
+#include <cstring>
+
+namespace GameplayMath
+{
+	const char* ToString(ECourseLayoutError Error)
+	{
+		switch (Error)
+		{
+		case ECourseLayoutError::None: return "ok";
+		case ECourseLayoutError::TooSmall: return "file too small";
+		case ECourseLayoutError::BadMagic: return "not a course layout";
+		case ECourseLayoutError::UnsupportedVersion: return "unsupported version";
+		case ECourseLayoutError::BadLayout: return "section offsets out of range";
+		case ECourseLayoutError::BadMeshIndex: return "record references a missing mesh";
+		case ECourseLayoutError::BadMeshPath: return "mesh path is not null-terminated";
+		}
+		return "unknown";
+	}
+
+	namespace
+	{
+		/** [Offset, Offset + Count * Stride) 가 파일 안인지 (오버플로 없이) */
+		bool IsSectionInRange(uint64_t Offset, uint64_t Count, uint64_t Stride, uint64_t Size)
+		{
+			return Offset <= Size && Count <= (Size - Offset) / Stride && Offset % 4 == 0;
+		}
+	}
+
+	ECourseLayoutError ParseCourseLayout(const void* Data, size_t Size, FCourseLayoutView& OutView)
+	{
+		OutView = FCourseLayoutView();
+		if (!Data || Size < sizeof(FCourseLayoutHeader)) return ECourseLayoutError::TooSmall;
+
+		const uint8_t* Bytes = static_cast<const uint8_t*>(Data);
+		const FCourseLayoutHeader& Header = *reinterpret_cast<const FCourseLayoutHeader*>(Bytes);
+
+		if (Header.Magic != CourseLayoutMagic) return ECourseLayoutError::BadMagic;
+		if (Header.Version != CourseLayoutVersion) return ECourseLayoutError::UnsupportedVersion;
+		if (Header.HeaderSize != sizeof(FCourseLayoutHeader) || Header.TotalSize > Size) return ECourseLayoutError::BadLayout;
+
+		if (!IsSectionInRange(Header.MeshOffset, Header.NumMeshes, sizeof(FCourseLayoutMesh), Header.TotalSize) ||
+			!IsSectionInRange(Header.PlatformOffset, Header.NumPlatforms, sizeof(FCourseLayoutPlatform), Header.TotalSize) ||
+			!IsSectionInRange(Header.LedgeOffset, Header.NumLedges, sizeof(FCourseLayoutLedge), Header.TotalSize))
+		{
+			return ECourseLayoutError::BadLayout;
+		}
+
+		FCourseLayoutView View;
+		View.Meshes = reinterpret_cast<const FCourseLayoutMesh*>(Bytes + Header.MeshOffset);
+		View.Platforms = reinterpret_cast<const FCourseLayoutPlatform*>(Bytes + Header.PlatformOffset);
+		View.Ledges = reinterpret_cast<const FCourseLayoutLedge*>(Bytes + Header.LedgeOffset);
+		View.NumMeshes = Header.NumMeshes;
+		View.NumPlatforms = Header.NumPlatforms;
+		View.NumLedges = Header.NumLedges;
+
+		// 한 번만 훑어서 이후 사용처가 인덱스와 경로 문자열을 믿을 수 있게
+		for (uint32_t i = 0; i < View.NumMeshes; ++i)
+		{
+			if (!std::memchr(View.Meshes[i].Path, 0, sizeof(View.Meshes[i].Path))) return ECourseLayoutError::BadMeshPath;
+		}
+		for (uint32_t i = 0; i < View.NumPlatforms; ++i)
+		{
+			if (View.Platforms[i].MeshIndex >= View.NumMeshes) return ECourseLayoutError::BadMeshIndex;
+		}
+		for (uint32_t i = 0; i < View.NumLedges; ++i)
+		{
+			if (View.Ledges[i].MeshIndex >= View.NumMeshes) return ECourseLayoutError::BadMeshIndex;
+		}
+
+		OutView = View;
+		return ECourseLayoutError::None;
+	}
+
+	std::vector<uint8_t> SerializeCourseLayout(const std::vector<FCourseLayoutMesh>& Meshes,
+		const std::vector<FCourseLayoutPlatform>& Platforms, const std::vector<FCourseLayoutLedge>& Ledges)
+	{
+		FCourseLayoutHeader Header;
+		Header.Magic = CourseLayoutMagic;
+		Header.Version = CourseLayoutVersion;
+		Header.HeaderSize = sizeof(FCourseLayoutHeader);
+		Header.NumMeshes = (uint32_t)Meshes.size();
+		Header.NumPlatforms = (uint32_t)Platforms.size();
+		Header.NumLedges = (uint32_t)Ledges.size();
+		Header.MeshOffset = sizeof(FCourseLayoutHeader);
+		Header.PlatformOffset = Header.MeshOffset + Header.NumMeshes * (uint32_t)sizeof(FCourseLayoutMesh);
+		Header.LedgeOffset = Header.PlatformOffset + Header.NumPlatforms * (uint32_t)sizeof(FCourseLayoutPlatform);
+		Header.TotalSize = Header.LedgeOffset + Header.NumLedges * (uint32_t)sizeof(FCourseLayoutLedge);
+
+		std::vector<uint8_t> Bytes(Header.TotalSize);
+		std::memcpy(Bytes.data(), &Header, sizeof(Header));
+		if (!Meshes.empty()) std::memcpy(Bytes.data() + Header.MeshOffset, Meshes.data(), Meshes.size() * sizeof(FCourseLayoutMesh));
+		if (!Platforms.empty()) std::memcpy(Bytes.data() + Header.PlatformOffset, Platforms.data(), Platforms.size() * sizeof(FCourseLayoutPlatform));
+		if (!Ledges.empty()) std::memcpy(Bytes.data() + Header.LedgeOffset, Ledges.data(), Ledges.size() * sizeof(FCourseLayoutLedge));
+		return Bytes;
+	}
+
+	FVec3 EvaluatePingPongAt(const FVec3& StartLocation, const FVec3& Velocity, double MoveDistance, double Time)
+	{
+		const double Speed = Size(Velocity);
+		if (Speed <= 0.0 || MoveDistance <= 0.0) return StartLocation;
+
+		// 왕복 한 번 = 2 * MoveDistance, 그 안에서 삼각파
+		// (fmod 보다 floor 가 훨씬 싸서 5만 개 갱신에 유리)
+		const double Period = 2.0 * MoveDistance;
+		const double Distance = Speed * (Time > 0.0 ? Time : 0.0);
+		const double Travel = Distance - std::floor(Distance / Period) * Period;
+		const double Offset = Travel <= MoveDistance ? Travel : Period - Travel;
+		return StartLocation + Velocity * (Offset / Speed);
+	}
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+// 코스 레이아웃 바이너리 포맷 (.oacl)
+// 발판/레지 정의를 고정 크기 레코드로 나열한 평평한 파일이라
+// 메모리 매핑한 포인터를 그대로 레코드 배열로 쓸 수 있다 (리틀 엔디언).
+//
+//   [FCourseLayoutHeader]
+//   [FCourseLayoutMesh    x NumMeshes]
+//   [FCourseLayoutPlatform x NumPlatforms]
+//   [FCourseLayoutLedge   x NumLedges]
+
+#include "GameplayMath.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace GameplayMath
+{
+	constexpr uint32_t CourseLayoutMagic = 0x4C43414F; // 'OACL'
+	constexpr uint32_t CourseLayoutVersion = 1;
+
+	struct FCourseLayoutHeader
+	{
+		uint32_t Magic;
+		uint32_t Version;
+		uint32_t HeaderSize;
+		uint32_t NumMeshes;
+		uint32_t NumPlatforms;
+		uint32_t NumLedges;
+		uint32_t MeshOffset;
+		uint32_t PlatformOffset;
+		uint32_t LedgeOffset;
+		uint32_t TotalSize;
+	};
+
+	/** 메시 에셋 경로 (UTF-8, 널 종료 필수 — 255바이트까지, 예: /Game/Meshes/SM_Platform.SM_Platform) */
+	struct FCourseLayoutMesh
+	{
+		char Path[256];
+	};
+
+	/** 왕복/회전 발판 하나 (AMovingPlatform 과 같은 파라미터) */
+	struct FCourseLayoutPlatform
+	{
+		float StartLocation[3];
+		float Velocity[3];
+		float MoveDistance;
+		/** Pitch, Yaw, Roll (도) */
+		float Rotation[3];
+		float RotationVelocity[3];
+		float Scale[3];
+		uint32_t MeshIndex;
+	};
+
+	/** 등반 가능한 정적 지형 (Climbable) */
+	struct FCourseLayoutLedge
+	{
+		float Location[3];
+		float Rotation[3];
+		float Scale[3];
+		uint32_t MeshIndex;
+	};
+
+	static_assert(sizeof(FCourseLayoutHeader) == 40, "course layout header is part of the file format");
+	static_assert(sizeof(FCourseLayoutPlatform) == 68, "course layout platform is part of the file format");
+	static_assert(sizeof(FCourseLayoutLedge) == 40, "course layout ledge is part of the file format");
+
+	/** 매핑된 파일 위의 읽기 전용 뷰 (복사 없음, 파일이 살아 있는 동안만 유효) */
+	struct FCourseLayoutView
+	{
+		const FCourseLayoutMesh* Meshes = nullptr;
+		const FCourseLayoutPlatform* Platforms = nullptr;
+		const FCourseLayoutLedge* Ledges = nullptr;
+		uint32_t NumMeshes = 0;
+		uint32_t NumPlatforms = 0;
+		uint32_t NumLedges = 0;
+	};
+
+	enum class ECourseLayoutError : uint8_t
+	{
+		None,
+		TooSmall,
+		BadMagic,
+		UnsupportedVersion,
+		BadLayout,
+		BadMeshIndex,
+		BadMeshPath,
+	};
+
+	const char* ToString(ECourseLayoutError Error);
+
+	/** 헤더와 범위, 메시 인덱스, 메시 경로의 널 종료를 검사하고 뷰를 채운다. Data는 4바이트 정렬이어야 한다 */
+	ECourseLayoutError ParseCourseLayout(const void* Data, size_t Size, FCourseLayoutView& OutView);
+
+	/** 레코드들을 파일 바이트로 직렬화 (내보내기/생성기용) */
+	std::vector<uint8_t> SerializeCourseLayout(const std::vector<FCourseLayoutMesh>& Meshes,
+		const std::vector<FCourseLayoutPlatform>& Platforms, const std::vector<FCourseLayoutLedge>& Ledges);
+
+	/**
+	 *  발판의 Time 초 시점 위치 (프레임 누적 없이 바로 계산)
+	 *  시작점에서 속도 방향으로 MoveDistance 까지 갔다가 돌아오는 삼각파.
+	 *  속도나 거리가 0이면 시작점에 머문다.
+	 */
+	FVec3 EvaluatePingPongAt(const FVec3& StartLocation, const FVec3& Velocity, double MoveDistance, double Time);
+}
@@ -0,0 +1,184 @@
+#include "GameplayMath.h"
+
+#include <cmath>
+
+namespace GameplayMath
+{
+	namespace
+	{
+		constexpr double SmallNumberSquared = 1.e-8;
+
+		/** 두 자리 0 채움 (printf 없이) */
+		inline char* WriteTwoDigits(char* Out, int32_t Value)
+		{
+			Out[0] = char('0' + (Value / 10) % 10);
+			Out[1] = char('0' + Value % 10);
+			return Out + 2;
+		}
+	}
+
+	double Dot(const FVec3& A, const FVec3& B)
+	{
+		return A.X * B.X + A.Y * B.Y + A.Z * B.Z;
+	}
+
+	double Size(const FVec3& V)
+	{
+		return std::sqrt(Dot(V, V));
+	}
+
+	double Dist(const FVec3& A, const FVec3& B)
+	{
+		return Size(A - B);
+	}
+
+	FVec3 SafeNormal(const FVec3& V)
+	{
+		const double SquareSum = Dot(V, V);
+		if (SquareSum == 1.0) return V;
+		if (SquareSum < SmallNumberSquared) return FVec3();
+		return V * (1.0 / std::sqrt(SquareSum));
+	}
+
+	bool StepPingPong(FPingPongState& State, double MoveDistance, double DeltaSeconds, double& OutOvershoot)
+	{
+		const double DistanceMoved = Dist(State.StartLocation, State.Location);
+		if (DistanceMoved >= MoveDistance)
+		{
+			OutOvershoot = DistanceMoved - MoveDistance;
+
+			const FVec3 NewStart = State.StartLocation + SafeNormal(State.Velocity) * MoveDistance;
+			State.Location = NewStart;
+			State.StartLocation = NewStart;
+			State.Velocity = -State.Velocity;
+			return true;
+		}
+
+		OutOvershoot = 0.0;
+		State.Location = State.Location + State.Velocity * DeltaSeconds;
+		return false;
+	}
+
+	FPingPongState AdvancePingPong(const FPingPongState& State, double MoveDistance, double Seconds)
+	{
+		const double Speed = Size(State.Velocity);
+		if (Speed <= 0.0 || MoveDistance <= 0.0 || Seconds <= 0.0) return State;
+
+		// 현재 구간 시작점부터 잰 거리를 편도 단위로 나눠 몇 번 반사했는지 계산
+		const FVec3 Direction = State.Velocity * (1.0 / Speed);
+		const double Along = std::min(Dist(State.StartLocation, State.Location), MoveDistance);
+		const double Travel = Along + Speed * Seconds;
+		const double Legs = std::floor(Travel / MoveDistance);
+		const double Within = Travel - Legs * MoveDistance;
+
+		FPingPongState Result = State;
+		if (Legs - 2.0 * std::floor(Legs * 0.5) != 0.0)
+		{
+			// 홀수 번 반사: StepPingPong 처럼 끝점이 새 시작점, 속도 반대
+			Result.StartLocation = State.StartLocation + Direction * MoveDistance;
+			Result.Velocity = -State.Velocity;
+			Result.Location = Result.StartLocation - Direction * Within;
+		}
+		else
+		{
+			Result.Location = State.StartLocation + Direction * Within;
+		}
+		return Result;
+	}
+
+	void ComputeWallProbe(const FVec3& ActorLocation, double YawDegrees, double HalfHeight, double Radius,
+		double ForwardCheckDistance, FVec3& OutStart, FVec3& OutEnd)
+	{
+		const double Yaw = YawDegrees * DegToRad;
+		const FVec3 Forward(std::cos(Yaw), std::sin(Yaw), 0.0);
+
+		OutStart = ActorLocation + FVec3(0.0, 0.0, HalfHeight * 0.5);
+		OutEnd = OutStart + Forward * (ForwardCheckDistance + Radius);
+	}
+
+	void ComputeTopProbe(const FVec3& WallImpactPoint, const FVec3& WallImpactNormal, double UpCheckHeight,
+		double DownCheckDepth, FVec3& OutStart, FVec3& OutEnd)
+	{
+		OutStart = WallImpactPoint + FVec3(0.0, 0.0, UpCheckHeight) - WallImpactNormal * 10.0;
+		OutEnd = OutStart - FVec3(0.0, 0.0, DownCheckDepth);
+	}
+
+	bool IsLedgeHeightInRange(double EdgeZ, double ActorZ, double HalfHeight, double MinLedgeHeight, double MaxLedgeHeight)
+	{
+		const double HeightDelta = EdgeZ - (ActorZ - HalfHeight);
+		return HeightDelta >= MinLedgeHeight && HeightDelta <= MaxLedgeHeight;
+	}
+
+	EAutoClimbDecision EvaluateAutoClimb(const FAutoClimbParams& Params, const FAutoClimbInput& Input, double& OutApproach)
+	{
+		OutApproach = 0.0;
+
+		if (Input.Now - Input.LastAutoClimbTime < Params.Cooldown) return EAutoClimbDecision::Cooldown;
+		if (Params.bRequireAirborne && !Input.bFalling) return EAutoClimbDecision::NotAirborne;
+
+		const FVec3 WallNormal = SafeNormal(Input.WallNormal);
+		if (!IsWallNormal(WallNormal)) return EAutoClimbDecision::NotWall;
+
+		OutApproach = Dot(Input.Forward, -WallNormal);
+		if (OutApproach < Params.MinApproachDot) return EAutoClimbDecision::Approach;
+
+		if (Dot(Input.Velocity, Input.Velocity) < Params.MinImpactSpeed * Params.MinImpactSpeed) return EAutoClimbDecision::ImpactSpeed;
+
+		return EAutoClimbDecision::Accept;
+	}
+
+	FHangPose ComputeHangPose(const FVec3& LedgeTopPoint, const FVec3& WallNormal, double HangOffsetFromEdge,
+		double HangZOffset, double HalfHeight)
+	{
+		const FVec3 OutFromWall = -WallNormal;
+
+		FHangPose Pose;
+		Pose.Location = LedgeTopPoint + OutFromWall * HangOffsetFromEdge + FVec3(0.0, 0.0, HangZOffset + HalfHeight);
+		// MakeFromXZ(OutFromWall, Up) 의 Yaw = X축의 수평 방향
+		Pose.YawDegrees = std::atan2(OutFromWall.Y, OutFromWall.X) * RadToDeg;
+		return Pose;
+	}
+
+	FVec3 ComputeClimbUpTarget(const FVec3& LedgeTopPoint, const FVec3& WallNormal, double StepForward, double HalfHeight)
+	{
+		return LedgeTopPoint + (-WallNormal) * StepForward + FVec3(0.0, 0.0, HalfHeight + 2.0);
+	}
+
+	int32_t PlaytimeWholeSeconds(float Seconds)
+	{
+		return Seconds > 0.f ? (int32_t)std::floor(Seconds) : 0;
+	}
+
+	int32_t FormatPlaytime(int32_t WholeSeconds, char* Buffer, size_t BufferSize)
+	{
+		if (BufferSize < 16) return 0;
+
+		const int32_t Total = WholeSeconds > 0 ? WholeSeconds : 0;
+		const int32_t H = Total / 3600;
+		const int32_t M = (Total % 3600) / 60;
+		const int32_t S = Total % 60;
+
+		char* Out = Buffer;
+		if (H > 0)
+		{
+			// 100시간 이상은 자릿수만 늘어남 (%02d 와 같음)
+			char Digits[10];
+			int32_t NumDigits = 0;
+			for (int32_t Value = H; Value > 0; Value /= 10)
+			{
+				Digits[NumDigits++] = char('0' + Value % 10);
+			}
+			if (NumDigits == 1) *Out++ = '0';
+			while (NumDigits > 0)
+			{
+				*Out++ = Digits[--NumDigits];
+			}
+			*Out++ = ':';
+		}
+		Out = WriteTwoDigits(Out, M);
+		*Out++ = ':';
+		Out = WriteTwoDigits(Out, S);
+		*Out = '\0';
+		return (int32_t)(Out - Buffer);
+	}
+}
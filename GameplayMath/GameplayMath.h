@@ -0,0 +1,145 @@
+#pragma once
+
+// 엔진 없이 빌드되는 게임플레이 수학 커널
+// (발판 왕복, 레지 판정, 매달림 위치, 플레이타임 표시)
+// 게임 클래스는 GameplayMathBridge.h 로 FVector와 변환해서 호출하고,
+// GameplayMath/CMakeLists.txt 의 벤치마크는 엔진 없이 같은 코드를 잰다.
+
+#include <cstddef>
+#include <cstdint>
+
+namespace GameplayMath
+{
+	/** UE5 FVector와 같은 double 정밀도 */
+	struct FVec3
+	{
+		double X = 0.0;
+		double Y = 0.0;
+		double Z = 0.0;
+
+		FVec3() = default;
+		constexpr FVec3(double InX, double InY, double InZ) : X(InX), Y(InY), Z(InZ) {}
+
+		FVec3 operator+(const FVec3& V) const { return FVec3(X + V.X, Y + V.Y, Z + V.Z); }
+		FVec3 operator-(const FVec3& V) const { return FVec3(X - V.X, Y - V.Y, Z - V.Z); }
+		FVec3 operator*(double S) const { return FVec3(X * S, Y * S, Z * S); }
+		FVec3 operator-() const { return FVec3(-X, -Y, -Z); }
+	};
+
+	/** 각도 변환 (FMath::RadiansToDegrees 와 같은 값) */
+	constexpr double RadToDeg = 57.295779513082320876798154814105;
+	constexpr double DegToRad = 0.017453292519943295769236907684886;
+
+	double Dot(const FVec3& A, const FVec3& B);
+	double Size(const FVec3& V);
+	double Dist(const FVec3& A, const FVec3& B);
+
+	/** 길이가 거의 0이면 영벡터 (FVector::GetSafeNormal 과 같은 규칙) */
+	FVec3 SafeNormal(const FVec3& V);
+
+	// ------------------------------------------------------------
+	// 발판 왕복 (AMovingPlatform::MovePlatform)
+	// ------------------------------------------------------------
+
+	struct FPingPongState
+	{
+		FVec3 Location;
+		FVec3 StartLocation;
+		FVec3 Velocity;
+	};
+
+	/**
+	 *  한 프레임 진행. 시작점에서 MoveDistance 이상 벗어났으면 끝점으로 스냅하고
+	 *  그 지점을 새 시작점으로 삼아 방향을 뒤집는다 (이 프레임은 이동 없음).
+	 *  @return 방향을 뒤집었으면 true, OutOvershoot 에 넘친 거리
+	 */
+	bool StepPingPong(FPingPongState& State, double MoveDistance, double DeltaSeconds, double& OutOvershoot);
+
+	/**
+	 *  State 에서 Seconds 초 진행한 상태를 바로 계산 (StepPingPong 으로 이어서 돌릴 수 있는 형태).
+	 *  끝점에서 한 프레임 멈추는 StepPingPong 과 달리 이상적인 왕복이라, 오래 돈 발판보다 반사 횟수 × 1프레임만큼 앞선다.
+	 */
+	FPingPongState AdvancePingPong(const FPingPongState& State, double MoveDistance, double Seconds);
+
+	// ------------------------------------------------------------
+	// 레지 판정 (FindLedge / OnCapsuleHit)
+	// ------------------------------------------------------------
+
+	/** 법선 Z가 이 값보다 크면 벽이 아니라 경사/바닥 */
+	constexpr double MaxWallNormalZ = 0.3;
+
+	inline bool IsWallNormal(const FVec3& Normal) { return Normal.Z <= MaxWallNormalZ; }
+
+	/** 전방 벽 탐지 라인 (가슴 높이에서 앞으로) */
+	void ComputeWallProbe(const FVec3& ActorLocation, double YawDegrees, double HalfHeight, double Radius,
+		double ForwardCheckDistance, FVec3& OutStart, FVec3& OutEnd);
+
+	/** 벽 위에서 아래로 상면을 찾는 라인 */
+	void ComputeTopProbe(const FVec3& WallImpactPoint, const FVec3& WallImpactNormal, double UpCheckHeight,
+		double DownCheckDepth, FVec3& OutStart, FVec3& OutEnd);
+
+	/** 발끝 기준 상면 높이가 [Min, Max] 안인지 */
+	bool IsLedgeHeightInRange(double EdgeZ, double ActorZ, double HalfHeight, double MinLedgeHeight, double MaxLedgeHeight);
+
+	/** OnCapsuleHit 자동 등반 판정 결과 (검사 순서대로) */
+	enum class EAutoClimbDecision : uint8_t
+	{
+		Accept,
+		Cooldown,
+		NotAirborne,
+		NotWall,
+		Approach,
+		ImpactSpeed,
+	};
+
+	struct FAutoClimbParams
+	{
+		double Cooldown = 0.6;
+		double MinImpactSpeed = 150.0;
+		double MinApproachDot = 0.6;
+		bool bRequireAirborne = true;
+	};
+
+	struct FAutoClimbInput
+	{
+		double Now = 0.0;
+		double LastAutoClimbTime = -1000.0;
+		bool bFalling = false;
+		FVec3 Forward;
+		FVec3 WallNormal;
+		FVec3 Velocity;
+	};
+
+	/** 레지 트레이스 전에 끝나는 값싼 검사들. OutApproach 는 Approach 단계까지 왔을 때만 채워짐 */
+	EAutoClimbDecision EvaluateAutoClimb(const FAutoClimbParams& Params, const FAutoClimbInput& Input, double& OutApproach);
+
+	// ------------------------------------------------------------
+	// 매달림/등반 위치 (EnterHang / ClimbUpCommit)
+	// ------------------------------------------------------------
+
+	struct FHangPose
+	{
+		FVec3 Location;
+		double YawDegrees = 0.0;
+	};
+
+	/** 벽을 바라보며 엣지 아래에 매달리는 위치와 방향 */
+	FHangPose ComputeHangPose(const FVec3& LedgeTopPoint, const FVec3& WallNormal, double HangOffsetFromEdge,
+		double HangZOffset, double HalfHeight);
+
+	/** 엣지를 넘어 StepForward 만큼 들어간 상면 위 캡슐 중심 */
+	FVec3 ComputeClimbUpTarget(const FVec3& LedgeTopPoint, const FVec3& WallNormal, double StepForward, double HalfHeight);
+
+	// ------------------------------------------------------------
+	// 플레이타임 표시 (UPlaytimeWidget::SetTimeSeconds)
+	// ------------------------------------------------------------
+
+	/** 표시용 정수 초 (음수는 0) */
+	int32_t PlaytimeWholeSeconds(float Seconds);
+
+	/**
+	 *  "MM:SS" 또는 한 시간 이상이면 "HH:MM:SS" 로 쓴다.
+	 *  @return 쓴 글자 수 (널 제외). Buffer는 최소 16바이트.
+	 */
+	int32_t FormatPlaytime(int32_t WholeSeconds, char* Buffer, size_t BufferSize);
+}
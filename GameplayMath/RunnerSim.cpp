@@ -0,0 +1,622 @@
+#include "RunnerSim.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
+
+namespace GameplayMath
+{
+	namespace
+	{
+		/** 밀어낸 뒤 면에서 띄우는 거리 (다음 스텝에 같은 면과 겹치지 않게) */
+		constexpr double Skin = 0.01;
+
+		/** 정책이 벽을 찾는 최대 거리 */
+		constexpr double WallLookAhead = 600.0;
+
+		/** 이 깊이 안에 바닥이 있으면 걸어 내려갈 수 있는 곳 (벽 위에서 내려오기 포함) */
+		constexpr double GroundAheadDepth = 300.0;
+
+		inline double& Component(FVec3& V, int32_t Axis)
+		{
+			return Axis == 0 ? V.X : (Axis == 1 ? V.Y : V.Z);
+		}
+
+		inline double Component(const FVec3& V, int32_t Axis)
+		{
+			return Axis == 0 ? V.X : (Axis == 1 ? V.Y : V.Z);
+		}
+
+		/** 왕복 박스가 X 로 훑는 범위 */
+		void GetSweptRangeX(const FRunnerSimBox& Box, double& OutMinX, double& OutMaxX)
+		{
+			const double TravelX = SafeNormal(Box.Velocity).X * Box.MoveDistance;
+			OutMinX = Box.Min.X + std::min(0.0, TravelX);
+			OutMaxX = Box.Max.X + std::max(0.0, TravelX);
+		}
+
+		/** [MinX, MaxX] 에 걸친 구간의 박스들 (여러 구간에 걸친 박스는 중복될 수 있음) */
+		template <typename TFunc>
+		void ForEachBoxInRange(const FRunnerSimCourse& Course, double MinX, double MaxX, TFunc&& Func)
+		{
+			if (Course.Buckets.empty()) return;
+
+			const int32_t Last = (int32_t)Course.Buckets.size() - 1;
+			const int32_t First = std::max(0, (int32_t)std::floor((MinX - Course.BucketOriginX) / Course.BucketSize));
+			const int32_t End = std::min(Last, (int32_t)std::floor((MaxX - Course.BucketOriginX) / Course.BucketSize));
+			for (int32_t Bucket = First; Bucket <= End; ++Bucket)
+			{
+				for (uint32_t Index : Course.Buckets[Bucket])
+				{
+					Func(Index, Course.Boxes[Index]);
+				}
+			}
+		}
+
+		FRunnerSimInput ScriptedBotInput(const FRunnerBotParams& Bot, const FRunnerSimObservation& Obs,
+			FRunnerSimRandom& Random, double& JumpThreshold, bool& bPrevJump)
+		{
+			FRunnerSimInput Input;
+			Input.Forward = 1.0;
+			Input.Right = Bot.StrafeNoise > 0.0 ? Random.Next(-Bot.StrafeNoise, Bot.StrafeNoise) : 0.0;
+
+			const bool bWallAhead = Obs.WallDistance >= 0.0 && Obs.WallDistance <= JumpThreshold && Obs.WallHeight > 40.0;
+			const bool bWantJump = !Obs.bFalling && !Obs.bClimbing && (bWallAhead || !Obs.bGroundAhead);
+
+			// 누르고 떼기를 번갈아 (DoJumpStart → DoJumpEnd), 점프할 때마다 거리 다시 뽑기
+			Input.bJump = bWantJump && !bPrevJump;
+			if (Input.bJump)
+			{
+				JumpThreshold = Bot.JumpDistance + Random.Next(-Bot.JumpJitter, Bot.JumpJitter);
+			}
+			bPrevJump = Input.bJump;
+			return Input;
+		}
+	}
+
+	const char* ToString(ERunnerSimOutcome Outcome)
+	{
+		switch (Outcome)
+		{
+		case ERunnerSimOutcome::Finished: return "finished";
+		case ERunnerSimOutcome::Fell: return "fell";
+		case ERunnerSimOutcome::TimedOut: return "timeout";
+		}
+		return "unknown";
+	}
+
+	// ------------------------------------------------------------
+	// 코스
+	// ------------------------------------------------------------
+
+	void FRunnerSimCourse::Build(double InBucketSize)
+	{
+		BucketSize = InBucketSize > 0.0 ? InBucketSize : 500.0;
+		Buckets.clear();
+		if (Boxes.empty()) return;
+
+		double CourseMinX = 1e300;
+		double CourseMaxX = -1e300;
+		for (const FRunnerSimBox& Box : Boxes)
+		{
+			double MinX, MaxX;
+			GetSweptRangeX(Box, MinX, MaxX);
+			CourseMinX = std::min(CourseMinX, MinX);
+			CourseMaxX = std::max(CourseMaxX, MaxX);
+		}
+
+		BucketOriginX = CourseMinX;
+		Buckets.resize((size_t)std::floor((CourseMaxX - CourseMinX) / BucketSize) + 1);
+
+		for (uint32_t Index = 0; Index < (uint32_t)Boxes.size(); ++Index)
+		{
+			double MinX, MaxX;
+			GetSweptRangeX(Boxes[Index], MinX, MaxX);
+			const size_t First = (size_t)std::floor((MinX - BucketOriginX) / BucketSize);
+			const size_t Last = std::min(Buckets.size() - 1, (size_t)std::floor((MaxX - BucketOriginX) / BucketSize));
+			for (size_t Bucket = First; Bucket <= Last; ++Bucket)
+			{
+				Buckets[Bucket].push_back(Index);
+			}
+		}
+	}
+
+	FRunnerSimCourse MakeRunnerSimCourse(const FCourseLayoutView& Layout, const FVec3& SpawnLocation, double FinishX,
+		double MeshHalfExtent)
+	{
+		FRunnerSimCourse Course;
+		Course.SpawnLocation = SpawnLocation;
+		Course.FinishX = FinishX;
+		Course.Boxes.reserve(Layout.NumLedges + Layout.NumPlatforms);
+
+		auto MakeBox = [MeshHalfExtent](const float Location[3], const float Scale[3])
+		{
+			const FVec3 Center(Location[0], Location[1], Location[2]);
+			const FVec3 Half(std::fabs(Scale[0]) * MeshHalfExtent, std::fabs(Scale[1]) * MeshHalfExtent, std::fabs(Scale[2]) * MeshHalfExtent);
+
+			FRunnerSimBox Box;
+			Box.Min = Center - Half;
+			Box.Max = Center + Half;
+			return Box;
+		};
+
+		double LowestZ = SpawnLocation.Z;
+		for (uint32_t i = 0; i < Layout.NumLedges; ++i)
+		{
+			const FCourseLayoutLedge& Ledge = Layout.Ledges[i];
+			Course.Boxes.push_back(MakeBox(Ledge.Location, Ledge.Scale));
+			LowestZ = std::min(LowestZ, Course.Boxes.back().Min.Z);
+		}
+		for (uint32_t i = 0; i < Layout.NumPlatforms; ++i)
+		{
+			const FCourseLayoutPlatform& Platform = Layout.Platforms[i];
+			FRunnerSimBox Box = MakeBox(Platform.StartLocation, Platform.Scale);
+			Box.Velocity = FVec3(Platform.Velocity[0], Platform.Velocity[1], Platform.Velocity[2]);
+			Box.MoveDistance = Platform.MoveDistance;
+			Course.Boxes.push_back(Box);
+			LowestZ = std::min(LowestZ, Box.Min.Z);
+		}
+
+		Course.KillZ = LowestZ - 1000.0;
+		Course.Build();
+		return Course;
+	}
+
+	FRunnerSimCourse MakeSyntheticRunnerCourse(int32_t NumSegments, uint32_t Seed)
+	{
+		FRunnerSimRandom Random;
+		Random.State = Seed;
+
+		FRunnerSimCourse Course;
+		Course.SpawnLocation = FVec3(100.0, 0.0, 97.0);
+		Course.KillZ = -600.0;
+
+		// 바닥 구간마다 벽 하나, 구간 사이에는 점프로 넘는 구멍
+		double X = -200.0;
+		for (int32_t Segment = 0; Segment < NumSegments; ++Segment)
+		{
+			const double Length = Random.Next(800.0, 1600.0);
+
+			FRunnerSimBox Floor;
+			Floor.Min = FVec3(X, -300.0, -400.0);
+			Floor.Max = FVec3(X + Length, 300.0, 0.0);
+			Course.Boxes.push_back(Floor);
+
+			// 기본값 기준으로 점프로 넘는 높이(~110 이하)와 가슴 탐지로 잡히는 등반 높이(150 이상) 반반.
+			// 그 사이는 기본 파라미터로는 넘을 수 없는 높이라 합성 코스에서는 뺀다
+			const double WallX = X + Length * 0.6;
+			const double WallWidth = Random.Next(60.0, 200.0);
+			const double WallHeight = Random.Next(0.0, 1.0) < 0.5 ? Random.Next(60.0, 100.0) : Random.Next(160.0, 260.0);
+			FRunnerSimBox Wall;
+			Wall.Min = FVec3(WallX, -300.0, 0.0);
+			Wall.Max = FVec3(WallX + WallWidth, 300.0, WallHeight);
+			Course.Boxes.push_back(Wall);
+
+			X += Length;
+			if (Segment + 1 < NumSegments)
+			{
+				X += Random.Next(120.0, 280.0);
+			}
+		}
+
+		Course.FinishX = X - 100.0;
+		Course.Build();
+		return Course;
+	}
+
+	// ------------------------------------------------------------
+	// 월드
+	// ------------------------------------------------------------
+
+	FRunnerSimWorld::FRunnerSimWorld(const FRunnerSimCourse& InCourse, const FRunnerSimParams& InParams)
+		: Course(InCourse)
+		, Params(InParams)
+		, Location(InCourse.SpawnLocation)
+	{
+		Result.MaxProgressX = Location.X;
+	}
+
+	FVec3 FRunnerSimWorld::BoxCenterOffset(const FRunnerSimBox& Box) const
+	{
+		if (Box.MoveDistance <= 0.0) return FVec3();
+		return EvaluatePingPongAt(FVec3(), Box.Velocity, Box.MoveDistance, Time);
+	}
+
+	bool FRunnerSimWorld::Raycast(const FVec3& Start, const FVec3& End, FRayHit& OutHit) const
+	{
+		const FVec3 Delta = End - Start;
+		double BestT = 2.0;
+
+		ForEachBoxInRange(Course, std::min(Start.X, End.X), std::max(Start.X, End.X), [&](uint32_t, const FRunnerSimBox& Box)
+		{
+			const FVec3 Offset = BoxCenterOffset(Box);
+			const FVec3 BoxMin = Box.Min + Offset;
+			const FVec3 BoxMax = Box.Max + Offset;
+
+			// 슬랩 교차. 시작점이 박스 안이면 맞지 않은 것으로 (라인 트레이스의 뒷면 규칙)
+			double Enter = -1e300;
+			double Exit = 1e300;
+			int32_t EnterAxis = -1;
+			double EnterSign = 0.0;
+			for (int32_t Axis = 0; Axis < 3; ++Axis)
+			{
+				const double S = Component(Start, Axis);
+				const double D = Component(Delta, Axis);
+				const double Lo = Component(BoxMin, Axis);
+				const double Hi = Component(BoxMax, Axis);
+				if (std::fabs(D) < 1e-12)
+				{
+					if (S < Lo || S > Hi) return;
+					continue;
+				}
+
+				double T0 = (Lo - S) / D;
+				double T1 = (Hi - S) / D;
+				double Sign = -1.0;
+				if (T0 > T1)
+				{
+					std::swap(T0, T1);
+					Sign = 1.0;
+				}
+				if (T0 > Enter)
+				{
+					Enter = T0;
+					EnterAxis = Axis;
+					EnterSign = Sign;
+				}
+				Exit = std::min(Exit, T1);
+			}
+
+			if (EnterAxis < 0 || Enter < 0.0 || Enter > Exit || Enter > 1.0 || Enter >= BestT) return;
+
+			BestT = Enter;
+			OutHit.Point = Start + Delta * Enter;
+			OutHit.Normal = FVec3();
+			Component(OutHit.Normal, EnterAxis) = EnterSign;
+			OutHit.TopZ = BoxMax.Z;
+		});
+
+		if (BestT > 1.0) return false;
+		OutHit.Distance = BestT * Size(Delta);
+		return true;
+	}
+
+	FRunnerSimObservation FRunnerSimWorld::Observe() const
+	{
+		FRunnerSimObservation Obs;
+		Obs.Time = Time;
+		Obs.Location = Location;
+		Obs.Velocity = Velocity;
+		Obs.YawDegrees = YawDegrees;
+		Obs.bFalling = bFalling;
+		Obs.bClimbing = bClimbing;
+
+		const double FeetZ = Location.Z - Params.CapsuleHalfHeight;
+
+		FRayHit Hit;
+		// 계단 높이(CharacterMovement MaxStepHeight 45)보다 조금 위: 걸어서 못 넘는 벽만
+		const FVec3 Knee(Location.X, Location.Y, FeetZ + 50.0);
+		if (Raycast(Knee, Knee + FVec3(WallLookAhead, 0.0, 0.0), Hit) && IsWallNormal(Hit.Normal))
+		{
+			Obs.WallDistance = std::max(0.0, Hit.Distance - Params.CapsuleRadius);
+			Obs.WallHeight = Hit.TopZ - FeetZ;
+		}
+
+		const FVec3 Ahead = Location + FVec3(Params.CapsuleRadius * 4.0, 0.0, 0.0);
+		Obs.bGroundAhead = Raycast(Ahead, FVec3(Ahead.X, Ahead.Y, FeetZ - GroundAheadDepth), Hit);
+		return Obs;
+	}
+
+	void FRunnerSimWorld::Step(const FRunnerSimInput& Input)
+	{
+		if (bDone) return;
+
+		const double Dt = Params.FixedDeltaSeconds;
+		Time += Dt;
+		++Result.Steps;
+
+		if (bClimbing)
+		{
+			StepClimb();
+		}
+		else
+		{
+			// DoMove: 컨트롤 Yaw 0 기준 입력 방향 (아날로그 크기 유지, 최대 1)
+			FVec3 Wish(Input.Forward, Input.Right, 0.0);
+			const double WishSize = std::min(1.0, Size(Wish));
+			Wish = SafeNormal(Wish);
+
+			FVec3 Horizontal(Velocity.X, Velocity.Y, 0.0);
+			if (WishSize > 0.0)
+			{
+				if (!bFalling)
+				{
+					// 지면 마찰로 속도를 입력 방향으로 돌림 (CharacterMovement GroundFriction 8)
+					const double Speed = Size(Horizontal);
+					Horizontal = Horizontal - (Horizontal - Wish * Speed) * std::min(1.0, Dt * 8.0);
+				}
+
+				const double Accel = Params.MaxAcceleration * (bFalling ? Params.AirControl : 1.0);
+				Horizontal = Horizontal + Wish * (Accel * Dt);
+
+				const double MaxSpeed = Params.MaxWalkSpeed * WishSize;
+				const double Speed = Size(Horizontal);
+				if (Speed > MaxSpeed) Horizontal = Horizontal * (MaxSpeed / Speed);
+			}
+			else
+			{
+				const double Braking = bFalling ? Params.BrakingDecelerationFalling : Params.BrakingDecelerationWalking;
+				const double Speed = Size(Horizontal);
+				const double NewSpeed = std::max(0.0, Speed - Braking * Dt);
+				Horizontal = Speed > 0.0 ? Horizontal * (NewSpeed / Speed) : Horizontal;
+			}
+			Velocity.X = Horizontal.X;
+			Velocity.Y = Horizontal.Y;
+
+			// DoJumpStart: 누르는 순간에만, 땅에 있을 때만
+			if (Input.bJump && !bJumpHeld && !bFalling)
+			{
+				Velocity.Z = Params.JumpZVelocity;
+				bFalling = true;
+				++Result.Jumps;
+			}
+			bJumpHeld = Input.bJump;
+
+			// 걷는 중에도 중력을 걸어 발밑이 사라지면 낙하로 전환
+			Velocity.Z += Params.GravityZ * Dt;
+
+			// bOrientRotationToMovement: 입력 방향으로 RotationRate 만큼 회전
+			if (WishSize > 0.0)
+			{
+				const double TargetYaw = std::atan2(Wish.Y, Wish.X) * RadToDeg;
+				double DeltaYaw = std::fmod(TargetYaw - YawDegrees + 540.0, 360.0) - 180.0;
+				const double MaxTurn = Params.RotationRate * Dt;
+				DeltaYaw = std::max(-MaxTurn, std::min(MaxTurn, DeltaYaw));
+				YawDegrees += DeltaYaw;
+			}
+
+			// 축별 이동. 벽에 걸려 등반이 시작되면 나머지 이동은 버림
+			for (int32_t Axis = 0; Axis < 3 && !bClimbing; ++Axis)
+			{
+				MoveAxis(Axis, Component(Velocity, Axis) * Dt);
+			}
+		}
+
+		Result.MaxProgressX = std::max(Result.MaxProgressX, Location.X);
+		Result.Seconds = Time;
+
+		if (Location.Z < Course.KillZ)
+		{
+			Result.Outcome = ERunnerSimOutcome::Fell;
+			bDone = true;
+		}
+		else if (Location.X >= Course.FinishX)
+		{
+			Result.Outcome = ERunnerSimOutcome::Finished;
+			bDone = true;
+		}
+		else if (Time >= Params.MaxSeconds)
+		{
+			Result.Outcome = ERunnerSimOutcome::TimedOut;
+			bDone = true;
+		}
+	}
+
+	void FRunnerSimWorld::MoveAxis(int32_t Axis, double Delta)
+	{
+		if (Delta == 0.0) return;
+
+		Component(Location, Axis) += Delta;
+
+		// 캡슐은 축 정렬 박스 (반지름, 반지름, 반높이) 로 근사
+		const FVec3 Extent(Params.CapsuleRadius, Params.CapsuleRadius, Params.CapsuleHalfHeight);
+		bool bHit = false;
+
+		ForEachBoxInRange(Course, Location.X - Extent.X, Location.X + Extent.X, [&](uint32_t, const FRunnerSimBox& Box)
+		{
+			const FVec3 Offset = BoxCenterOffset(Box);
+			const FVec3 BoxMin = Box.Min + Offset;
+			const FVec3 BoxMax = Box.Max + Offset;
+			for (int32_t Check = 0; Check < 3; ++Check)
+			{
+				const double C = Component(Location, Check);
+				const double E = Component(Extent, Check);
+				if (C + E <= Component(BoxMin, Check) || C - E >= Component(BoxMax, Check)) return;
+			}
+
+			// 이동한 축으로만 밀어냄
+			Component(Location, Axis) = Delta > 0.0
+				? Component(BoxMin, Axis) - Component(Extent, Axis) - Skin
+				: Component(BoxMax, Axis) + Component(Extent, Axis) + Skin;
+			bHit = true;
+		});
+
+		if (Axis == 2)
+		{
+			if (bHit)
+			{
+				if (Delta < 0.0) bFalling = false;
+				Velocity.Z = 0.0;
+			}
+			else if (Delta < 0.0)
+			{
+				bFalling = true;
+			}
+			return;
+		}
+
+		if (bHit)
+		{
+			// OnCapsuleHit 은 충돌 순간의 속도를 본다
+			const FVec3 ImpactVelocity = Velocity;
+			FVec3 WallNormal;
+			Component(WallNormal, Axis) = Delta > 0.0 ? -1.0 : 1.0;
+			Component(Velocity, Axis) = 0.0;
+			OnWallHit(WallNormal, ImpactVelocity);
+		}
+	}
+
+	void FRunnerSimWorld::OnWallHit(const FVec3& WallNormal, const FVec3& ImpactVelocity)
+	{
+		if (!Params.bAutoClimbEnabled || bClimbing) return;
+
+		FAutoClimbInput ClimbInput;
+		ClimbInput.Now = Time;
+		ClimbInput.LastAutoClimbTime = LastAutoClimbTime;
+		ClimbInput.bFalling = bFalling;
+		ClimbInput.Forward = FVec3(std::cos(YawDegrees * DegToRad), std::sin(YawDegrees * DegToRad), 0.0);
+		ClimbInput.WallNormal = WallNormal;
+		ClimbInput.Velocity = ImpactVelocity;
+
+		double Approach = 0.0;
+		switch (EvaluateAutoClimb(Params.AutoClimb, ClimbInput, Approach))
+		{
+		case EAutoClimbDecision::Accept:
+			break;
+		case EAutoClimbDecision::Approach:
+			++Result.RejectApproach;
+			return;
+		case EAutoClimbDecision::ImpactSpeed:
+			++Result.RejectImpactSpeed;
+			return;
+		default:
+			return;
+		}
+
+		FVec3 Top, Normal;
+		if (!FindLedge(Top, Normal))
+		{
+			++Result.RejectNoLedge;
+			return;
+		}
+
+		// EnterHang + StartClimbUpSequence
+		const FHangPose Pose = ComputeHangPose(Top, Normal, Params.HangOffsetFromEdge, Params.HangZOffset, Params.CapsuleHalfHeight);
+		Location = Pose.Location;
+		YawDegrees = Pose.YawDegrees;
+		Velocity = FVec3();
+		LedgeTop = Top;
+		LedgeWallNormal = Normal;
+		LastAutoClimbTime = Time;
+
+		bClimbing = true;
+		bClimbCommitted = false;
+		ClimbElapsed = 0.0;
+		++Result.Climbs;
+	}
+
+	bool FRunnerSimWorld::FindLedge(FVec3& OutLedgeTop, FVec3& OutWallNormal) const
+	{
+		FVec3 WallStart, WallEnd;
+		ComputeWallProbe(Location, YawDegrees, Params.CapsuleHalfHeight, Params.CapsuleRadius, Params.ForwardCheckDistance, WallStart, WallEnd);
+
+		FRayHit WallHit;
+		if (!Raycast(WallStart, WallEnd, WallHit) || !IsWallNormal(WallHit.Normal)) return false;
+
+		FVec3 TopStart, TopEnd;
+		ComputeTopProbe(WallHit.Point, WallHit.Normal, Params.UpCheckHeight, Params.DownCheckDepth, TopStart, TopEnd);
+
+		FRayHit TopHit;
+		if (!Raycast(TopStart, TopEnd, TopHit)) return false;
+
+		if (!IsLedgeHeightInRange(TopHit.Point.Z, Location.Z, Params.CapsuleHalfHeight, Params.MinLedgeHeight, Params.MaxLedgeHeight)) return false;
+
+		OutLedgeTop = TopHit.Point;
+		OutWallNormal = WallHit.Normal;
+		return true;
+	}
+
+	void FRunnerSimWorld::SnapToFloor(double DownTrace)
+	{
+		FRayHit Hit;
+		const FVec3 End = Location - FVec3(0.0, 0.0, Params.CapsuleHalfHeight + DownTrace);
+		if (Raycast(Location, End, Hit))
+		{
+			Location.Z = Hit.Point.Z + Params.CapsuleHalfHeight + Skin;
+		}
+	}
+
+	void FRunnerSimWorld::StepClimb()
+	{
+		ClimbElapsed += Params.FixedDeltaSeconds;
+
+		// ClimbUpCommit: 엣지 위로 옮기고 벽 안쪽을 바라봄
+		if (!bClimbCommitted && ClimbElapsed >= Params.ClimbCommitTime)
+		{
+			Location = ComputeClimbUpTarget(LedgeTop, LedgeWallNormal, Params.ClimbStepForward, Params.CapsuleHalfHeight);
+			YawDegrees = std::atan2(-LedgeWallNormal.Y, -LedgeWallNormal.X) * RadToDeg;
+			SnapToFloor(150.0);
+			bClimbCommitted = true;
+		}
+
+		// FinishClimbUpSequence: 걷기로 복귀
+		if (ClimbElapsed >= Params.ClimbDuration)
+		{
+			SnapToFloor(150.0);
+			bClimbing = false;
+			bFalling = false;
+			Velocity = FVec3();
+		}
+	}
+
+	// ------------------------------------------------------------
+	// 실행
+	// ------------------------------------------------------------
+
+	FRunnerSimResult RunRunnerSim(const FRunnerSimCourse& Course, const FRunnerSimJob& Job)
+	{
+		FRunnerSimWorld World(Course, Job.Params);
+
+		FRunnerSimRandom Random;
+		Random.State = Job.Seed * 2654435761u + 1u;
+
+		double JumpThreshold = Job.Bot.JumpDistance;
+		bool bPrevJump = false;
+
+		while (!World.IsDone())
+		{
+			const FRunnerSimObservation Obs = World.Observe();
+			const FRunnerSimInput Input = Job.Policy
+				? Job.Policy(Obs, Random)
+				: ScriptedBotInput(Job.Bot, Obs, Random, JumpThreshold, bPrevJump);
+			World.Step(Input);
+		}
+		return World.GetResult();
+	}
+
+	std::vector<FRunnerSimResult> RunRunnerSimBatch(const FRunnerSimCourse& Course, const std::vector<FRunnerSimJob>& Jobs,
+		int32_t NumThreads)
+	{
+		std::vector<FRunnerSimResult> Results(Jobs.size());
+		if (Jobs.empty()) return Results;
+
+		if (NumThreads <= 0) NumThreads = (int32_t)std::max(1u, std::thread::hardware_concurrency());
+		NumThreads = std::min<int32_t>(NumThreads, (int32_t)Jobs.size());
+
+		// 작업 하나(월드 하나)가 수천 스텝이라 하나씩 가져가도 원자 연산 비용은 무시할 만함
+		std::atomic<size_t> NextJob{ 0 };
+		auto Worker = [&]()
+		{
+			for (;;)
+			{
+				const size_t Index = NextJob.fetch_add(1, std::memory_order_relaxed);
+				if (Index >= Jobs.size()) break;
+				Results[Index] = RunRunnerSim(Course, Jobs[Index]);
+			}
+		};
+
+		std::vector<std::thread> Threads;
+		Threads.reserve(NumThreads - 1);
+		for (int32_t i = 1; i < NumThreads; ++i)
+		{
+			Threads.emplace_back(Worker);
+		}
+		Worker();
+		for (std::thread& Thread : Threads)
+		{
+			Thread.join();
+		}
+		return Results;
+	}
+}
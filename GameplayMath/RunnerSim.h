@@ -0,0 +1,232 @@
+#pragma once
+
+// 헤드리스 러너 시뮬레이션 (자동 등반 튜닝 / 봇 학습용)
+// AObstacleAssualtCharacter 의 이동·자동 등반 경로(OnCapsuleHit → FindLedge → EnterHang →
+// ClimbUpCommit)를 엔진 없이 같은 GameplayMath 커널로 고정 스텝 재현한다.
+// 월드 하나 = 코스(읽기 전용, 공유) + 러너 상태(월드마다 따로)라서
+// RunRunnerSimBatch 가 작업 스레드마다 월드를 통째로 맡겨 코어 수만큼 병렬로 돌린다.
+//
+// 코스 진행 방향은 +X, 입력의 Forward/Right 는 컨트롤 Yaw 0 기준 (+X / +Y).
+
+#include "GameplayMath.h"
+#include "CourseLayout.h"
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace GameplayMath
+{
+	/** 축 정렬 박스 하나 (바닥/벽/발판). Velocity 가 있으면 EvaluatePingPongAt 으로 왕복 */
+	struct FRunnerSimBox
+	{
+		FVec3 Min;
+		FVec3 Max;
+		FVec3 Velocity;
+		double MoveDistance = 0.0;
+	};
+
+	/** 시뮬레이션 코스. Boxes 를 채운 뒤 Build() 를 한 번 불러야 한다 */
+	struct FRunnerSimCourse
+	{
+		std::vector<FRunnerSimBox> Boxes;
+		FVec3 SpawnLocation;
+		/** 캡슐 중심 X가 이 값을 넘으면 완주 */
+		double FinishX = 0.0;
+		/** 이 아래로 떨어지면 낙사 */
+		double KillZ = -1000.0;
+
+		/** X 구간별 박스 목록 (왕복 범위 포함). 스텝마다 전체 박스를 훑지 않도록 */
+		void Build(double BucketSize = 500.0);
+
+		double BucketSize = 500.0;
+		double BucketOriginX = 0.0;
+		std::vector<std::vector<uint32_t>> Buckets;
+	};
+
+	/** 레이아웃의 레지(정적)와 발판(왕복)을 박스로 변환. 회전은 무시, 기본 큐브는 반 크기 50 */
+	FRunnerSimCourse MakeRunnerSimCourse(const FCourseLayoutView& Layout, const FVec3& SpawnLocation, double FinishX,
+		double MeshHalfExtent = 50.0);
+
+	/** 바닥 구간 + 구멍 + 다양한 높이의 벽으로 된 합성 코스 (같은 Seed면 같은 코스) */
+	FRunnerSimCourse MakeSyntheticRunnerCourse(int32_t NumSegments, uint32_t Seed);
+
+	/** AObstacleAssualtCharacter / CharacterMovement 기본값과 맞춘 파라미터 */
+	struct FRunnerSimParams
+	{
+		FAutoClimbParams AutoClimb;
+		bool bAutoClimbEnabled = true;
+
+		// Ledge|Trace, Ledge|Snap
+		double ForwardCheckDistance = 70.0;
+		double UpCheckHeight = 90.0;
+		double DownCheckDepth = 120.0;
+		double MinLedgeHeight = 60.0;
+		double MaxLedgeHeight = 180.0;
+		double HangOffsetFromEdge = 35.0;
+		double HangZOffset = -40.0;
+		double ClimbStepForward = 30.0;
+
+		// 몽타주 대용: 시작 후 ClimbCommitTime 에 위치 커밋, ClimbDuration 에 이동 복귀
+		double ClimbCommitTime = 0.45;
+		double ClimbDuration = 0.9;
+
+		// 캡슐 / CharacterMovement
+		double CapsuleRadius = 42.0;
+		double CapsuleHalfHeight = 96.0;
+		double MaxWalkSpeed = 500.0;
+		double MaxAcceleration = 2048.0;
+		double BrakingDecelerationWalking = 2000.0;
+		double BrakingDecelerationFalling = 1500.0;
+		double AirControl = 0.35;
+		double JumpZVelocity = 500.0;
+		double GravityZ = -980.0;
+		double RotationRate = 500.0;
+
+		double FixedDeltaSeconds = 1.0 / 60.0;
+		double MaxSeconds = 120.0;
+	};
+
+	/** DoMove(Right, Forward) / DoJumpStart·DoJumpEnd 에 해당하는 한 스텝 입력 */
+	struct FRunnerSimInput
+	{
+		double Forward = 0.0;
+		double Right = 0.0;
+		bool bJump = false;
+	};
+
+	/** 정책이 보는 값 */
+	struct FRunnerSimObservation
+	{
+		double Time = 0.0;
+		FVec3 Location;
+		FVec3 Velocity;
+		double YawDegrees = 0.0;
+		bool bFalling = false;
+		bool bClimbing = false;
+		/** +X 방향, 걸어서 못 넘는 벽까지 거리 (없으면 -1) */
+		double WallDistance = -1.0;
+		/** 그 벽 윗면의 발끝 기준 높이 (벽이 없으면 0) */
+		double WallHeight = 0.0;
+		/** 한 걸음(캡슐 지름 2배) 앞, 발끝 아래 3m 안에 바닥이 있는지 (없으면 구멍) */
+		bool bGroundAhead = true;
+	};
+
+	/** 월드마다 하나씩 쓰는 결정적 난수 (벤치와 같은 LCG) */
+	struct FRunnerSimRandom
+	{
+		uint32_t State = 12345u;
+		double Next(double Min, double Max)
+		{
+			State = State * 1664525u + 1013904223u;
+			return Min + (Max - Min) * ((State >> 8) * (1.0 / 16777216.0));
+		}
+	};
+
+	/** 외부 학습 정책. 비워 두면 FRunnerBotParams 의 스크립트 봇 */
+	using FRunnerSimPolicy = std::function<FRunnerSimInput(const FRunnerSimObservation&, FRunnerSimRandom&)>;
+
+	/** 기본 스크립트 봇: 앞으로 달리다가 벽/구멍 앞에서 점프 */
+	struct FRunnerBotParams
+	{
+		double JumpDistance = 110.0;
+		/** 점프 거리 흔들림 (±) — 같은 설정으로 여러 번 돌려 분포를 보기 위함 */
+		double JumpJitter = 40.0;
+		/** 좌우 입력 흔들림 (정면 접근 각도 분포용) */
+		double StrafeNoise = 0.15;
+	};
+
+	enum class ERunnerSimOutcome : uint8_t
+	{
+		Finished,
+		Fell,
+		TimedOut,
+	};
+
+	const char* ToString(ERunnerSimOutcome Outcome);
+
+	/** 월드 하나의 결과. 작업 스레드들이 인접 슬롯에 쓰므로 캐시 라인 단위로 정렬 */
+	struct alignas(64) FRunnerSimResult
+	{
+		ERunnerSimOutcome Outcome = ERunnerSimOutcome::TimedOut;
+		double Seconds = 0.0;
+		double MaxProgressX = 0.0;
+		int32_t Steps = 0;
+		int32_t Jumps = 0;
+		int32_t Climbs = 0;
+		/** ETelemetryClimbReject 와 같은 분류: 접근 각도 / 충돌 속도 / 레지 없음 */
+		int32_t RejectApproach = 0;
+		int32_t RejectImpactSpeed = 0;
+		int32_t RejectNoLedge = 0;
+	};
+
+	/** 독립된 러너 월드 하나. 코스만 공유하고 나머지 상태는 전부 이 객체 안에 있다 */
+	class FRunnerSimWorld
+	{
+	public:
+		FRunnerSimWorld(const FRunnerSimCourse& InCourse, const FRunnerSimParams& InParams);
+
+		FRunnerSimObservation Observe() const;
+		void Step(const FRunnerSimInput& Input);
+
+		bool IsDone() const { return bDone; }
+		const FRunnerSimResult& GetResult() const { return Result; }
+
+	private:
+		struct FRayHit
+		{
+			double Distance = 0.0;
+			FVec3 Point;
+			FVec3 Normal;
+			/** 맞은 박스의 윗면 Z */
+			double TopZ = 0.0;
+		};
+
+		FVec3 BoxCenterOffset(const FRunnerSimBox& Box) const;
+		bool Raycast(const FVec3& Start, const FVec3& End, FRayHit& OutHit) const;
+		void MoveAxis(int32_t Axis, double Delta);
+		void OnWallHit(const FVec3& WallNormal, const FVec3& ImpactVelocity);
+		bool FindLedge(FVec3& OutLedgeTop, FVec3& OutWallNormal) const;
+		void SnapToFloor(double DownTrace);
+		void StepClimb();
+
+		const FRunnerSimCourse& Course;
+		FRunnerSimParams Params;
+
+		FVec3 Location;
+		FVec3 Velocity;
+		double YawDegrees = 0.0;
+		double Time = 0.0;
+		bool bFalling = true;
+		bool bJumpHeld = false;
+		bool bDone = false;
+
+		bool bClimbing = false;
+		bool bClimbCommitted = false;
+		double ClimbElapsed = 0.0;
+		double LastAutoClimbTime = -1000.0;
+		FVec3 LedgeTop;
+		FVec3 LedgeWallNormal;
+
+		FRunnerSimResult Result;
+	};
+
+	/** 배치 안의 작업 하나 = 월드 하나 */
+	struct FRunnerSimJob
+	{
+		FRunnerSimParams Params;
+		FRunnerBotParams Bot;
+		FRunnerSimPolicy Policy;
+		uint32_t Seed = 1;
+	};
+
+	/** 월드 하나를 끝날 때까지 (완주/낙사/시간 초과) 돌린다 */
+	FRunnerSimResult RunRunnerSim(const FRunnerSimCourse& Course, const FRunnerSimJob& Job);
+
+	/**
+	 *  작업들을 NumThreads 개 스레드(호출 스레드 포함)로 나눠 돌리고 작업 순서대로 결과를 돌려준다.
+	 *  스레드 간 공유 상태는 다음 작업 인덱스(원자 변수) 하나뿐이다. NumThreads <= 0 이면 하드웨어 스레드 수.
+	 */
+	std::vector<FRunnerSimResult> RunRunnerSimBatch(const FRunnerSimCourse& Course, const std::vector<FRunnerSimJob>& Jobs,
+		int32_t NumThreads);
+}
@@ -0,0 +1,334 @@
+// 헤드리스 러너 시뮬레이터 (엔진 없이 빌드, GameplayMath/CMakeLists.txt)
+//
+//   RunnerSim [--layout course.oacl --spawn X,Y,Z --finish X] [--segments 20] [--course-seed 7]
+//             [--runs 256] [--threads N] [--batch 4096] [--max-seconds 120]
+//             [--sweep Name=Min:Max:Step]... [--csv out.csv] [--scaling]
+//
+// --sweep 의 조합마다 --runs 개의 월드(시드만 다름)를 돌려 완주율/시간/등반·거절 수를 모은다.
+// 작업은 --batch 개씩 묶어 스레드 풀에 넘기고, 묶음이 끝날 때마다 결과를 합친다.
+// --scaling 은 같은 묶음을 1, 2, 4, ... 스레드로 돌려 코어 수에 따른 처리량을 출력한다.
+//
+// Sweep 이름: MinImpactSpeed, MinApproachDot, AutoClimbCooldown, MinLedgeHeight, MaxLedgeHeight,
+//             JumpDistance, JumpJitter
+
+// 엔진 모듈 안에서는 UBT가 이 파일도 모으므로 main 은 엔진 밖에서만
+#if !defined(WITH_ENGINE)
+
+#include "../RunnerSim.h"
+#include "../CourseLayout.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace GameplayMath;
+
+namespace
+{
+	struct FSweepAxis
+	{
+		std::string Name;
+		std::vector<double> Values;
+	};
+
+	/** 이름으로 작업 파라미터 하나를 바꾼다. 모르는 이름이면 false */
+	bool ApplySweepValue(FRunnerSimJob& Job, const std::string& Name, double Value)
+	{
+		if (Name == "MinImpactSpeed") Job.Params.AutoClimb.MinImpactSpeed = Value;
+		else if (Name == "MinApproachDot") Job.Params.AutoClimb.MinApproachDot = Value;
+		else if (Name == "AutoClimbCooldown") Job.Params.AutoClimb.Cooldown = Value;
+		else if (Name == "MinLedgeHeight") Job.Params.MinLedgeHeight = Value;
+		else if (Name == "MaxLedgeHeight") Job.Params.MaxLedgeHeight = Value;
+		else if (Name == "JumpDistance") Job.Bot.JumpDistance = Value;
+		else if (Name == "JumpJitter") Job.Bot.JumpJitter = Value;
+		else return false;
+		return true;
+	}
+
+	/** "Name=Min:Max:Step" */
+	bool ParseSweep(const char* Text, FSweepAxis& OutAxis)
+	{
+		const char* Equals = std::strchr(Text, '=');
+		if (!Equals) return false;
+
+		double Min = 0.0, Max = 0.0, Step = 0.0;
+		if (std::sscanf(Equals + 1, "%lf:%lf:%lf", &Min, &Max, &Step) != 3 || Step <= 0.0 || Max < Min) return false;
+
+		OutAxis.Name.assign(Text, Equals);
+		FRunnerSimJob Probe;
+		if (!ApplySweepValue(Probe, OutAxis.Name, Min)) return false;
+
+		OutAxis.Values.clear();
+		for (double Value = Min; Value <= Max + Step * 1e-6; Value += Step)
+		{
+			OutAxis.Values.push_back(Value);
+		}
+		return true;
+	}
+
+	bool ParseVec3(const char* Text, FVec3& Out)
+	{
+		return std::sscanf(Text, "%lf,%lf,%lf", &Out.X, &Out.Y, &Out.Z) == 3;
+	}
+
+	bool LoadLayoutCourse(const std::string& Path, const FVec3& Spawn, double FinishX, FRunnerSimCourse& OutCourse)
+	{
+		std::ifstream In(Path, std::ios::binary | std::ios::ate);
+		if (!In)
+		{
+			std::fprintf(stderr, "cannot open %s\n", Path.c_str());
+			return false;
+		}
+
+		// ParseCourseLayout 는 4바이트 정렬을 요구
+		const size_t Size = (size_t)In.tellg();
+		std::vector<uint32_t> Words((Size + 3) / 4);
+		In.seekg(0);
+		In.read(reinterpret_cast<char*>(Words.data()), (std::streamsize)Size);
+
+		FCourseLayoutView View;
+		const ECourseLayoutError Error = ParseCourseLayout(Words.data(), Size, View);
+		if (Error != ECourseLayoutError::None)
+		{
+			std::fprintf(stderr, "%s: %s\n", Path.c_str(), ToString(Error));
+			return false;
+		}
+
+		OutCourse = MakeRunnerSimCourse(View, Spawn, FinishX);
+		return true;
+	}
+
+	/** 설정 하나의 누적 결과 */
+	struct FConfigStats
+	{
+		std::vector<double> Values;
+		int32_t Runs = 0;
+		int32_t Finished = 0;
+		int32_t Fell = 0;
+		int32_t TimedOut = 0;
+		double FinishSecondsSum = 0.0;
+		int64_t Steps = 0;
+		int64_t Jumps = 0;
+		int64_t Climbs = 0;
+		int64_t RejectApproach = 0;
+		int64_t RejectImpactSpeed = 0;
+		int64_t RejectNoLedge = 0;
+
+		void Add(const FRunnerSimResult& Result)
+		{
+			++Runs;
+			Finished += Result.Outcome == ERunnerSimOutcome::Finished ? 1 : 0;
+			Fell += Result.Outcome == ERunnerSimOutcome::Fell ? 1 : 0;
+			TimedOut += Result.Outcome == ERunnerSimOutcome::TimedOut ? 1 : 0;
+			FinishSecondsSum += Result.Outcome == ERunnerSimOutcome::Finished ? Result.Seconds : 0.0;
+			Steps += Result.Steps;
+			Jumps += Result.Jumps;
+			Climbs += Result.Climbs;
+			RejectApproach += Result.RejectApproach;
+			RejectImpactSpeed += Result.RejectImpactSpeed;
+			RejectNoLedge += Result.RejectNoLedge;
+		}
+
+		double PerRun(int64_t Count) const { return Runs > 0 ? (double)Count / Runs : 0.0; }
+		double MeanFinishSeconds() const { return Finished > 0 ? FinishSecondsSum / Finished : 0.0; }
+	};
+
+	/** 같은 작업 묶음을 스레드 수를 늘려 가며 돌린다 */
+	void RunScaling(const FRunnerSimCourse& Course, const std::vector<FRunnerSimJob>& Jobs, int32_t MaxThreads)
+	{
+		std::printf("%8s %10s %12s %9s %11s\n", "threads", "runs/s", "Msteps/s", "speedup", "efficiency");
+
+		double SingleRate = 0.0;
+		for (int32_t Threads = 1; ; Threads = Threads * 2 > MaxThreads && Threads < MaxThreads ? MaxThreads : Threads * 2)
+		{
+			const auto Start = std::chrono::steady_clock::now();
+			const std::vector<FRunnerSimResult> Results = RunRunnerSimBatch(Course, Jobs, Threads);
+			const double Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+
+			int64_t Steps = 0;
+			for (const FRunnerSimResult& Result : Results) Steps += Result.Steps;
+
+			const double Rate = Results.size() / Seconds;
+			if (Threads == 1) SingleRate = Rate;
+			const double Speedup = SingleRate > 0.0 ? Rate / SingleRate : 0.0;
+			std::printf("%8d %10.1f %12.2f %8.2fx %10.0f%%\n", Threads, Rate, Steps / Seconds * 1e-6, Speedup, Speedup / Threads * 100.0);
+
+			if (Threads >= MaxThreads) break;
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	std::string LayoutPath;
+	FVec3 Spawn(0.0, 0.0, 200.0);
+	double FinishX = 0.0;
+	int32_t Segments = 20;
+	uint32_t CourseSeed = 7;
+	int32_t Runs = 256;
+	int32_t NumThreads = 0;
+	int32_t BatchSize = 4096;
+	double MaxSeconds = 120.0;
+	std::vector<FSweepAxis> Sweeps;
+	std::string CsvPath;
+	bool bScaling = false;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const bool bHasValue = i + 1 < argc;
+		bool bOk = true;
+		if (!std::strcmp(argv[i], "--layout") && bHasValue) LayoutPath = argv[++i];
+		else if (!std::strcmp(argv[i], "--spawn") && bHasValue) bOk = ParseVec3(argv[++i], Spawn);
+		else if (!std::strcmp(argv[i], "--finish") && bHasValue) FinishX = std::atof(argv[++i]);
+		else if (!std::strcmp(argv[i], "--segments") && bHasValue) Segments = std::atoi(argv[++i]);
+		else if (!std::strcmp(argv[i], "--course-seed") && bHasValue) CourseSeed = (uint32_t)std::strtoul(argv[++i], nullptr, 10);
+		else if (!std::strcmp(argv[i], "--runs") && bHasValue) Runs = std::atoi(argv[++i]);
+		else if (!std::strcmp(argv[i], "--threads") && bHasValue) NumThreads = std::atoi(argv[++i]);
+		else if (!std::strcmp(argv[i], "--batch") && bHasValue) BatchSize = std::atoi(argv[++i]);
+		else if (!std::strcmp(argv[i], "--max-seconds") && bHasValue) MaxSeconds = std::atof(argv[++i]);
+		else if (!std::strcmp(argv[i], "--csv") && bHasValue) CsvPath = argv[++i];
+		else if (!std::strcmp(argv[i], "--scaling")) bScaling = true;
+		else if (!std::strcmp(argv[i], "--sweep") && bHasValue)
+		{
+			FSweepAxis Axis;
+			bOk = ParseSweep(argv[++i], Axis);
+			if (bOk) Sweeps.push_back(Axis);
+		}
+		else bOk = false;
+
+		if (!bOk)
+		{
+			std::fprintf(stderr, "usage: %s [--layout course.oacl --spawn X,Y,Z --finish X] [--segments N] [--course-seed N]\n"
+				"       [--runs N] [--threads N] [--batch N] [--max-seconds S] [--sweep Name=Min:Max:Step]... [--csv out.csv] [--scaling]\n", argv[0]);
+			return 2;
+		}
+	}
+	if (Runs < 1) Runs = 1;
+	if (BatchSize < 1) BatchSize = 1;
+	const int32_t HardwareThreads = (int32_t)std::max(1u, std::thread::hardware_concurrency());
+	if (NumThreads <= 0) NumThreads = HardwareThreads;
+
+	FRunnerSimCourse Course;
+	if (!LayoutPath.empty())
+	{
+		if (!LoadLayoutCourse(LayoutPath, Spawn, FinishX, Course)) return 1;
+	}
+	else
+	{
+		Course = MakeSyntheticRunnerCourse(Segments > 0 ? Segments : 1, CourseSeed);
+	}
+	std::printf("course: %zu boxes, finish X %.0f\n", Course.Boxes.size(), Course.FinishX);
+
+	// 스윕 조합 (데카르트 곱). 스윕이 없으면 기본값 하나
+	std::vector<FConfigStats> Configs(1);
+	for (const FSweepAxis& Axis : Sweeps)
+	{
+		std::vector<FConfigStats> Expanded;
+		for (const FConfigStats& Config : Configs)
+		{
+			for (double Value : Axis.Values)
+			{
+				FConfigStats Next = Config;
+				Next.Values.push_back(Value);
+				Expanded.push_back(Next);
+			}
+		}
+		Configs.swap(Expanded);
+	}
+
+	auto MakeJob = [&](size_t ConfigIndex, int32_t Run)
+	{
+		FRunnerSimJob Job;
+		Job.Params.MaxSeconds = MaxSeconds;
+		for (size_t Axis = 0; Axis < Sweeps.size(); ++Axis)
+		{
+			ApplySweepValue(Job, Sweeps[Axis].Name, Configs[ConfigIndex].Values[Axis]);
+		}
+		// 설정끼리는 같은 시드 집합을 써서 차이가 파라미터에서만 나오게
+		Job.Seed = (uint32_t)Run + 1u;
+		return Job;
+	};
+
+	if (bScaling)
+	{
+		std::vector<FRunnerSimJob> Jobs;
+		for (int32_t Run = 0; Run < Runs; ++Run) Jobs.push_back(MakeJob(0, Run));
+		RunScaling(Course, Jobs, NumThreads);
+		return 0;
+	}
+
+	const int64_t TotalJobs = (int64_t)Configs.size() * Runs;
+	const auto Start = std::chrono::steady_clock::now();
+	int64_t TotalSteps = 0;
+
+	std::vector<FRunnerSimJob> Batch;
+	std::vector<size_t> BatchConfig;
+	Batch.reserve(BatchSize);
+	BatchConfig.reserve(BatchSize);
+
+	for (int64_t JobIndex = 0; JobIndex < TotalJobs; )
+	{
+		Batch.clear();
+		BatchConfig.clear();
+		for (; JobIndex < TotalJobs && (int32_t)Batch.size() < BatchSize; ++JobIndex)
+		{
+			const size_t ConfigIndex = (size_t)(JobIndex / Runs);
+			Batch.push_back(MakeJob(ConfigIndex, (int32_t)(JobIndex % Runs)));
+			BatchConfig.push_back(ConfigIndex);
+		}
+
+		const std::vector<FRunnerSimResult> Results = RunRunnerSimBatch(Course, Batch, NumThreads);
+		for (size_t i = 0; i < Results.size(); ++i)
+		{
+			Configs[BatchConfig[i]].Add(Results[i]);
+			TotalSteps += Results[i].Steps;
+		}
+		std::fprintf(stderr, "\r%lld / %lld runs", (long long)JobIndex, (long long)TotalJobs);
+	}
+	std::fprintf(stderr, "\n");
+
+	const double Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+
+	std::FILE* Csv = CsvPath.empty() ? nullptr : std::fopen(CsvPath.c_str(), "w");
+	if (!CsvPath.empty() && !Csv)
+	{
+		std::fprintf(stderr, "cannot write %s\n", CsvPath.c_str());
+	}
+
+	std::string Header;
+	for (const FSweepAxis& Axis : Sweeps) Header += Axis.Name + ",";
+	if (Csv) std::fprintf(Csv, "%sruns,finish_rate,fell_rate,timeout_rate,mean_finish_s,jumps,climbs,reject_approach,reject_impact_speed,reject_no_ledge\n", Header.c_str());
+
+	for (const FSweepAxis& Axis : Sweeps) std::printf("%18s ", Axis.Name.c_str());
+	std::printf("%7s %7s %7s %9s %7s %7s %17s\n", "finish", "fell", "timeout", "mean s", "jumps", "climbs", "reject A/I/N");
+
+	for (const FConfigStats& Config : Configs)
+	{
+		for (double Value : Config.Values) std::printf("%18.3f ", Value);
+		std::printf("%6.1f%% %6.1f%% %6.1f%% %9.2f %7.2f %7.2f %5.1f/%5.1f/%5.1f\n",
+			100.0 * Config.Finished / Config.Runs, 100.0 * Config.Fell / Config.Runs, 100.0 * Config.TimedOut / Config.Runs,
+			Config.MeanFinishSeconds(), Config.PerRun(Config.Jumps), Config.PerRun(Config.Climbs),
+			Config.PerRun(Config.RejectApproach), Config.PerRun(Config.RejectImpactSpeed), Config.PerRun(Config.RejectNoLedge));
+
+		if (Csv)
+		{
+			for (double Value : Config.Values) std::fprintf(Csv, "%g,", Value);
+			std::fprintf(Csv, "%d,%.4f,%.4f,%.4f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f\n",
+				Config.Runs, (double)Config.Finished / Config.Runs, (double)Config.Fell / Config.Runs, (double)Config.TimedOut / Config.Runs,
+				Config.MeanFinishSeconds(), Config.PerRun(Config.Jumps), Config.PerRun(Config.Climbs),
+				Config.PerRun(Config.RejectApproach), Config.PerRun(Config.RejectImpactSpeed), Config.PerRun(Config.RejectNoLedge));
+		}
+	}
+	if (Csv) std::fclose(Csv);
+
+	std::printf("%lld runs, %.2f Msteps in %.2f s on %d threads (%.1f runs/s, %.2f Msteps/s)\n",
+		(long long)TotalJobs, TotalSteps * 1e-6, Seconds, NumThreads, TotalJobs / Seconds, TotalSteps / Seconds * 1e-6);
+	return 0;
+}
+
+#endif // !WITH_ENGINE
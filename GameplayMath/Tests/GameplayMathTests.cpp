@@ -0,0 +1,348 @@
+// GameplayMath 단위 테스트 (엔진 없이 빌드, GameplayMath/CMakeLists.txt 의 ctest)
+//
+//   GameplayMathTests
+//
+// 기대값은 리팩터링 전 게임 코드(AMovingPlatform::MovePlatform, UPlaytimeWidget::SetTimeSeconds,
+// AObstacleAssualtCharacter 의 OnCapsuleHit / FindLedge / EnterHang / ClimbUpCommit)를
+// 기본 프로퍼티 값(캡슐 42 x 96 등)으로 손으로 계산한 결과다. 실패가 있으면 1로 끝난다.
+
+// 엔진 모듈 안에서는 UBT가 이 파일도 모으므로 main 은 엔진 밖에서만
+#if !defined(WITH_ENGINE)
+
+#include "../GameplayMath.h"
+#include "../CourseLayout.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+using namespace GameplayMath;
+
+namespace
+{
+	int GChecks = 0;
+	int GFailures = 0;
+
+	void Check(bool bCondition, const char* Expression, const char* File, int Line)
+	{
+		++GChecks;
+		if (!bCondition)
+		{
+			++GFailures;
+			std::fprintf(stderr, "%s:%d: FAILED: %s\n", File, Line, Expression);
+		}
+	}
+
+	bool Near(double A, double B, double Tolerance = 1e-4)
+	{
+		return std::fabs(A - B) <= Tolerance;
+	}
+
+	bool Near(const FVec3& A, const FVec3& B, double Tolerance = 1e-4)
+	{
+		return Near(A.X, B.X, Tolerance) && Near(A.Y, B.Y, Tolerance) && Near(A.Z, B.Z, Tolerance);
+	}
+
+	bool Equal(const char* A, const char* B)
+	{
+		return std::strcmp(A, B) == 0;
+	}
+
+	/** 리팩터링 전 캐릭터 기본값 */
+	constexpr double HalfHeight = 96.0;
+	constexpr double Radius = 42.0;
+	constexpr double ForwardCheckDistance = 70.0;
+	constexpr double UpCheckHeight = 90.0;
+	constexpr double DownCheckDepth = 120.0;
+	constexpr double MinLedgeHeight = 60.0;
+	constexpr double MaxLedgeHeight = 180.0;
+	constexpr double HangOffsetFromEdge = 35.0;
+	constexpr double HangZOffset = -40.0;
+	constexpr double ClimbStepForward = 30.0;
+
+	/** 리팩터링 전 발판 기본값 (MoveDistance 100) */
+	constexpr double MoveDistance = 100.0;
+}
+
+#define GM_CHECK(Expr) Check((Expr), #Expr, __FILE__, __LINE__)
+
+static void TestStepPingPong()
+{
+	// 100 uu/s, 0.25초 프레임: 25, 50, 75, 100 까지 이동, 다음 프레임에 끝점 스냅 + 반전 (이동 없음)
+	FPingPongState State;
+	State.Velocity = FVec3(100.0, 0.0, 0.0);
+
+	double Overshoot = -1.0;
+	for (int Frame = 1; Frame <= 4; ++Frame)
+	{
+		GM_CHECK(!StepPingPong(State, MoveDistance, 0.25, Overshoot));
+		GM_CHECK(Near(Overshoot, 0.0));
+		GM_CHECK(Near(State.Location, FVec3(25.0 * Frame, 0.0, 0.0)));
+	}
+
+	GM_CHECK(StepPingPong(State, MoveDistance, 0.25, Overshoot));
+	GM_CHECK(Near(Overshoot, 0.0));
+	GM_CHECK(Near(State.Location, FVec3(100.0, 0.0, 0.0)));
+	GM_CHECK(Near(State.StartLocation, FVec3(100.0, 0.0, 0.0)));
+	GM_CHECK(Near(State.Velocity, FVec3(-100.0, 0.0, 0.0)));
+
+	GM_CHECK(!StepPingPong(State, MoveDistance, 0.25, Overshoot));
+	GM_CHECK(Near(State.Location, FVec3(75.0, 0.0, 0.0)));
+
+	// 0.3초 프레임: 120 까지 넘어간 뒤 20 넘침, 끝점(시작점 + 방향 * 100)으로 스냅
+	FPingPongState Over;
+	Over.StartLocation = FVec3(0.0, 0.0, 50.0);
+	Over.Location = Over.StartLocation;
+	Over.Velocity = FVec3(0.0, 100.0, 0.0);
+	for (int Frame = 0; Frame < 4; ++Frame)
+	{
+		StepPingPong(Over, MoveDistance, 0.3, Overshoot);
+	}
+	GM_CHECK(Near(Over.Location, FVec3(0.0, 120.0, 50.0)));
+	GM_CHECK(StepPingPong(Over, MoveDistance, 0.3, Overshoot));
+	GM_CHECK(Near(Overshoot, 20.0));
+	GM_CHECK(Near(Over.Location, FVec3(0.0, 100.0, 50.0)));
+	GM_CHECK(Near(Over.Velocity, FVec3(0.0, -100.0, 0.0)));
+
+	// 속도 0이면 제자리 (SafeNormal 영벡터)
+	FPingPongState Still;
+	GM_CHECK(StepPingPong(Still, 0.0, 0.25, Overshoot));
+	GM_CHECK(Near(Still.Location, FVec3()));
+}
+
+static void TestAdvancePingPong()
+{
+	FPingPongState State;
+	State.Velocity = FVec3(100.0, 0.0, 0.0);
+
+	// 반사 없음
+	FPingPongState Half = AdvancePingPong(State, MoveDistance, 0.5);
+	GM_CHECK(Near(Half.Location, FVec3(50.0, 0.0, 0.0)));
+	GM_CHECK(Near(Half.StartLocation, FVec3()));
+	GM_CHECK(Near(Half.Velocity, FVec3(100.0, 0.0, 0.0)));
+
+	// 한 번 반사: 끝점이 새 시작점, 돌아오는 중
+	FPingPongState Once = AdvancePingPong(State, MoveDistance, 1.5);
+	GM_CHECK(Near(Once.Location, FVec3(50.0, 0.0, 0.0)));
+	GM_CHECK(Near(Once.StartLocation, FVec3(100.0, 0.0, 0.0)));
+	GM_CHECK(Near(Once.Velocity, FVec3(-100.0, 0.0, 0.0)));
+
+	// 두 번 반사: 처음 방향
+	FPingPongState Twice = AdvancePingPong(State, MoveDistance, 2.25);
+	GM_CHECK(Near(Twice.Location, FVec3(25.0, 0.0, 0.0)));
+	GM_CHECK(Near(Twice.StartLocation, FVec3()));
+	GM_CHECK(Near(Twice.Velocity, FVec3(100.0, 0.0, 0.0)));
+
+	// 구간 중간에서 시작해도 이어서 계산 (75 에서 0.5초 → 끝점 반사 후 75)
+	FPingPongState Mid = State;
+	Mid.Location = FVec3(75.0, 0.0, 0.0);
+	FPingPongState MidAdvanced = AdvancePingPong(Mid, MoveDistance, 0.5);
+	GM_CHECK(Near(MidAdvanced.Location, FVec3(75.0, 0.0, 0.0)));
+	GM_CHECK(Near(MidAdvanced.Velocity, FVec3(-100.0, 0.0, 0.0)));
+
+	// 반사가 없는 구간에서는 StepPingPong 을 이어 돌린 것과 같음
+	FPingPongState Stepped = State;
+	double Overshoot = 0.0;
+	for (int Frame = 0; Frame < 3; ++Frame)
+	{
+		StepPingPong(Stepped, MoveDistance, 0.25, Overshoot);
+	}
+	GM_CHECK(Near(AdvancePingPong(State, MoveDistance, 0.75).Location, Stepped.Location));
+
+	// 0초나 정지 발판은 그대로
+	GM_CHECK(Near(AdvancePingPong(State, MoveDistance, 0.0).Location, State.Location));
+	FPingPongState Still;
+	GM_CHECK(Near(AdvancePingPong(Still, MoveDistance, 3.0).Location, FVec3()));
+}
+
+static void TestFormatPlaytime()
+{
+	struct FCase
+	{
+		float Seconds;
+		const char* Expected;
+	};
+
+	// SetTimeSeconds: Max(0, s) 내림, 한 시간 미만 "%02d:%02d", 이상 "%02d:%02d:%02d"
+	const FCase Cases[] =
+	{
+		{ 0.f, "00:00" },
+		{ -5.f, "00:00" },
+		{ 0.99f, "00:00" },
+		{ 59.9f, "00:59" },
+		{ 61.f, "01:01" },
+		{ 3599.f, "59:59" },
+		{ 3600.f, "01:00:00" },
+		{ 3661.5f, "01:01:01" },
+		{ 36000.f, "10:00:00" },
+		{ 360000.f, "100:00:00" },
+	};
+
+	for (const FCase& Case : Cases)
+	{
+		char Buffer[16];
+		const int32_t Length = FormatPlaytime(PlaytimeWholeSeconds(Case.Seconds), Buffer, sizeof(Buffer));
+		GM_CHECK(Equal(Buffer, Case.Expected));
+		GM_CHECK(Length == (int32_t)std::strlen(Case.Expected));
+	}
+
+	char Small[8];
+	GM_CHECK(FormatPlaytime(61, Small, sizeof(Small)) == 0);
+}
+
+static void TestEvaluateAutoClimb()
+{
+	// OnCapsuleHit 기본값: 쿨다운 0.6, 최소 충돌 속도 150, 정면 0.6, 공중에서만
+	const FAutoClimbParams Params;
+
+	FAutoClimbInput Base;
+	Base.Now = 10.0;
+	Base.LastAutoClimbTime = -1000.0;
+	Base.bFalling = true;
+	Base.Forward = FVec3(1.0, 0.0, 0.0);
+	Base.WallNormal = FVec3(-1.0, 0.0, 0.0);
+	Base.Velocity = FVec3(300.0, 0.0, 0.0);
+
+	double Approach = -1.0;
+	GM_CHECK(EvaluateAutoClimb(Params, Base, Approach) == EAutoClimbDecision::Accept);
+	GM_CHECK(Near(Approach, 1.0));
+
+	// 쿨다운은 가장 먼저 (다른 조건이 다 틀려도 Cooldown)
+	FAutoClimbInput Cooldown = Base;
+	Cooldown.LastAutoClimbTime = 9.5;
+	Cooldown.bFalling = false;
+	GM_CHECK(EvaluateAutoClimb(Params, Cooldown, Approach) == EAutoClimbDecision::Cooldown);
+	GM_CHECK(Near(Approach, 0.0));
+	Cooldown.LastAutoClimbTime = 9.0;
+	Cooldown.bFalling = true;
+	GM_CHECK(EvaluateAutoClimb(Params, Cooldown, Approach) == EAutoClimbDecision::Accept);
+
+	FAutoClimbInput Grounded = Base;
+	Grounded.bFalling = false;
+	GM_CHECK(EvaluateAutoClimb(Params, Grounded, Approach) == EAutoClimbDecision::NotAirborne);
+
+	FAutoClimbParams AnyState = Params;
+	AnyState.bRequireAirborne = false;
+	GM_CHECK(EvaluateAutoClimb(AnyState, Grounded, Approach) == EAutoClimbDecision::Accept);
+
+	// 법선 Z > 0.3 은 경사/바닥 (정규화 후 판정: (-1, 0, 1) → Z 0.707)
+	FAutoClimbInput Slope = Base;
+	Slope.WallNormal = FVec3(-1.0, 0.0, 1.0);
+	GM_CHECK(EvaluateAutoClimb(Params, Slope, Approach) == EAutoClimbDecision::NotWall);
+	Slope.WallNormal = FVec3(-4.0, 0.0, 1.0);
+	GM_CHECK(EvaluateAutoClimb(Params, Slope, Approach) == EAutoClimbDecision::Accept);
+
+	// 정면 정도: 45도 0.707 통과, 60도 0.5 거절 (OutApproach 에 값)
+	const double Sin45 = std::sqrt(0.5);
+	FAutoClimbInput Oblique = Base;
+	Oblique.Forward = FVec3(Sin45, Sin45, 0.0);
+	GM_CHECK(EvaluateAutoClimb(Params, Oblique, Approach) == EAutoClimbDecision::Accept);
+	GM_CHECK(Near(Approach, Sin45));
+	Oblique.Forward = FVec3(0.5, std::sqrt(0.75), 0.0);
+	GM_CHECK(EvaluateAutoClimb(Params, Oblique, Approach) == EAutoClimbDecision::Approach);
+	GM_CHECK(Near(Approach, 0.5));
+
+	// 속도 제곱 < 150^2 만 거절 (150 은 통과)
+	FAutoClimbInput Slow = Base;
+	Slow.Velocity = FVec3(149.0, 0.0, 0.0);
+	GM_CHECK(EvaluateAutoClimb(Params, Slow, Approach) == EAutoClimbDecision::ImpactSpeed);
+	Slow.Velocity = FVec3(90.0, 0.0, -120.0);
+	GM_CHECK(EvaluateAutoClimb(Params, Slow, Approach) == EAutoClimbDecision::Accept);
+}
+
+static void TestLedgeProbes()
+{
+	// FindLedge: 가슴(중심 + HalfHeight/2)에서 Yaw 방향으로 ForwardCheckDistance + Radius
+	FVec3 Start;
+	FVec3 End;
+	ComputeWallProbe(FVec3(0.0, 0.0, 96.0), 90.0, HalfHeight, Radius, ForwardCheckDistance, Start, End);
+	GM_CHECK(Near(Start, FVec3(0.0, 0.0, 144.0)));
+	GM_CHECK(Near(End, FVec3(0.0, 112.0, 144.0)));
+
+	// 벽 너머 10, UpCheckHeight 위에서 DownCheckDepth 만큼 아래로
+	ComputeTopProbe(FVec3(112.0, 0.0, 144.0), FVec3(-1.0, 0.0, 0.0), UpCheckHeight, DownCheckDepth, Start, End);
+	GM_CHECK(Near(Start, FVec3(122.0, 0.0, 234.0)));
+	GM_CHECK(Near(End, FVec3(122.0, 0.0, 114.0)));
+}
+
+static void TestIsLedgeHeightInRange()
+{
+	// 발끝 = 중심 Z - HalfHeight. 중심 96 이면 발끝 0, 범위 [60, 180] 양끝 포함
+	GM_CHECK(IsLedgeHeightInRange(60.0, 96.0, HalfHeight, MinLedgeHeight, MaxLedgeHeight));
+	GM_CHECK(IsLedgeHeightInRange(180.0, 96.0, HalfHeight, MinLedgeHeight, MaxLedgeHeight));
+	GM_CHECK(!IsLedgeHeightInRange(59.9, 96.0, HalfHeight, MinLedgeHeight, MaxLedgeHeight));
+	GM_CHECK(!IsLedgeHeightInRange(180.1, 96.0, HalfHeight, MinLedgeHeight, MaxLedgeHeight));
+	GM_CHECK(IsLedgeHeightInRange(1100.0, 1096.0 - 60.0, HalfHeight, MinLedgeHeight, MaxLedgeHeight));
+}
+
+static void TestComputeHangPose()
+{
+	// EnterHang: 엣지 + (-법선) * 35 + (0, 0, -40 + 96), 벽을 바라보는 Yaw
+	FHangPose Pose = ComputeHangPose(FVec3(100.0, 0.0, 150.0), FVec3(-1.0, 0.0, 0.0), HangOffsetFromEdge, HangZOffset, HalfHeight);
+	GM_CHECK(Near(Pose.Location, FVec3(135.0, 0.0, 206.0)));
+	GM_CHECK(Near(Pose.YawDegrees, 0.0));
+
+	Pose = ComputeHangPose(FVec3(100.0, 0.0, 150.0), FVec3(0.0, 1.0, 0.0), HangOffsetFromEdge, HangZOffset, HalfHeight);
+	GM_CHECK(Near(Pose.Location, FVec3(100.0, -35.0, 206.0)));
+	GM_CHECK(Near(Pose.YawDegrees, -90.0));
+
+	Pose = ComputeHangPose(FVec3(0.0, 0.0, 0.0), FVec3(1.0, 0.0, 0.0), HangOffsetFromEdge, HangZOffset, HalfHeight);
+	GM_CHECK(Near(Pose.Location, FVec3(-35.0, 0.0, 56.0)));
+	GM_CHECK(Near(std::fabs(Pose.YawDegrees), 180.0));
+}
+
+static void TestComputeClimbUpTarget()
+{
+	// ClimbUpCommit: 엣지 + (-법선) * 30, Z 는 + HalfHeight + 2
+	GM_CHECK(Near(ComputeClimbUpTarget(FVec3(100.0, 0.0, 150.0), FVec3(-1.0, 0.0, 0.0), ClimbStepForward, HalfHeight), FVec3(130.0, 0.0, 248.0)));
+	GM_CHECK(Near(ComputeClimbUpTarget(FVec3(-20.0, 40.0, 0.0), FVec3(0.0, -1.0, 0.0), ClimbStepForward, HalfHeight), FVec3(-20.0, 70.0, 98.0)));
+}
+
+static void TestParseCourseLayout()
+{
+	FCourseLayoutMesh Mesh = {};
+	std::strcpy(Mesh.Path, "/Game/Meshes/SM_Platform.SM_Platform");
+	FCourseLayoutPlatform Platform = {};
+	FCourseLayoutLedge Ledge = {};
+
+	std::vector<uint8_t> Bytes = SerializeCourseLayout({ Mesh }, { Platform }, { Ledge });
+	FCourseLayoutView View;
+	GM_CHECK(ParseCourseLayout(Bytes.data(), Bytes.size(), View) == ECourseLayoutError::None);
+	GM_CHECK(View.NumMeshes == 1 && View.NumPlatforms == 1 && View.NumLedges == 1);
+	GM_CHECK(Equal(View.Meshes[0].Path, Mesh.Path));
+
+	// 경로 칸 256바이트가 전부 글자면 (널 없음) 거절. 이후 경로를 문자열로 읽으면 범위를 넘기 때문
+	FCourseLayoutMesh Unterminated;
+	std::memset(Unterminated.Path, 'A', sizeof(Unterminated.Path));
+	Bytes = SerializeCourseLayout({ Mesh, Unterminated }, { Platform }, {});
+	GM_CHECK(ParseCourseLayout(Bytes.data(), Bytes.size(), View) == ECourseLayoutError::BadMeshPath);
+	GM_CHECK(View.Meshes == nullptr);
+
+	// 마지막 바이트만 널이면 255바이트 경로로 통과
+	Unterminated.Path[sizeof(Unterminated.Path) - 1] = '\0';
+	Bytes = SerializeCourseLayout({ Mesh, Unterminated }, { Platform }, {});
+	GM_CHECK(ParseCourseLayout(Bytes.data(), Bytes.size(), View) == ECourseLayoutError::None);
+	GM_CHECK(std::strlen(View.Meshes[1].Path) == sizeof(Unterminated.Path) - 1);
+
+	Platform.MeshIndex = 2;
+	Bytes = SerializeCourseLayout({ Mesh, Unterminated }, { Platform }, {});
+	GM_CHECK(ParseCourseLayout(Bytes.data(), Bytes.size(), View) == ECourseLayoutError::BadMeshIndex);
+}
+
+int main()
+{
+	TestStepPingPong();
+	TestAdvancePingPong();
+	TestFormatPlaytime();
+	TestEvaluateAutoClimb();
+	TestLedgeProbes();
+	TestIsLedgeHeightInRange();
+	TestComputeHangPose();
+	TestComputeClimbUpTarget();
+	TestParseCourseLayout();
+
+	std::printf("GameplayMathTests: %d checks, %d failed\n", GChecks, GFailures);
+	return GFailures == 0 ? 0 : 1;
+}
+
+#endif // !defined(WITH_ENGINE)
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayMath/GameplayMath.h"
+
+/** FVector <-> GameplayMath::FVec3 (둘 다 double이라 손실 없음) */
+FORCEINLINE GameplayMath::FVec3 ToGameplayMath(const FVector& V)
+{
+	return GameplayMath::FVec3(V.X, V.Y, V.Z);
+}
+
+FORCEINLINE FVector FromGameplayMath(const GameplayMath::FVec3& V)
+{
+	return FVector(V.X, V.Y, V.Z);
+}
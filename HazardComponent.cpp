@@ -0,0 +1,42 @@
+#include "HazardComponent.h"
+#include "HazardSubsystem.h"
+#include "Engine/World.h"
+
+UHazardComponent::UHazardComponent()
+{
+	// 판정은 서브시스템이 일괄로 하므로 컴포넌트 틱은 필요 없음
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UHazardComponent::GetWorldSegment(FVector& OutStart, FVector& OutEnd) const
+{
+	const FTransform& T = GetComponentTransform();
+	OutStart = T.GetLocation();
+	OutEnd = Shape == EHazardShape::Segment ? OutStart + T.GetUnitAxis(EAxis::X) * Length : OutStart;
+}
+
+void UHazardComponent::OnRegister()
+{
+	Super::OnRegister();
+
+	if (UWorld* World = GetWorld())
+	{
+		if (UHazardSubsystem* Hazards = World->GetSubsystem<UHazardSubsystem>())
+		{
+			Hazards->RegisterHazard(this);
+		}
+	}
+}
+
+void UHazardComponent::OnUnregister()
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UHazardSubsystem* Hazards = World->GetSubsystem<UHazardSubsystem>())
+		{
+			Hazards->UnregisterHazard(this);
+		}
+	}
+
+	Super::OnUnregister();
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SceneComponent.h"
+#include "HazardComponent.generated.h"
+
+UENUM(BlueprintType)
+enum class EHazardShape : uint8
+{
+	/** 컴포넌트 위치 중심의 구 */
+	Sphere,
+	/** 컴포넌트 위치에서 로컬 X축으로 Length만큼 뻗은 캡슐 (회전 스위퍼 팔, 푸셔 판) */
+	Segment,
+};
+
+/**
+ *  러너를 밀쳐내는 위험 요소 형상
+ *  물리 히트 이벤트를 쓰지 않고 UHazardSubsystem이 매 프레임 일괄 판정한다.
+ *  AMovingPlatform 등 움직이는 액터에 붙이면 액터의 이동/회전을 그대로 따라간다.
+ */
+UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
+class OBSTACLEASSUALT_API UHazardComponent : public USceneComponent
+{
+	GENERATED_BODY()
+
+public:
+	UHazardComponent();
+
+	UPROPERTY(EditAnywhere, Category = "Hazard")
+	EHazardShape Shape = EHazardShape::Segment;
+
+	UPROPERTY(EditAnywhere, Category = "Hazard", meta = (ClampMin = "0.0"))
+	float Radius = 30.f;
+
+	/** Segment 길이 (로컬 X축) */
+	UPROPERTY(EditAnywhere, Category = "Hazard", meta = (ClampMin = "0.0", EditCondition = "Shape == EHazardShape::Segment"))
+	float Length = 300.f;
+
+	/** 접촉면 바깥쪽으로 밀어내는 속도 (cm/s) */
+	UPROPERTY(EditAnywhere, Category = "Hazard|Knockback")
+	float KnockbackSpeed = 900.f;
+
+	/** 접촉 지점의 위험 요소 속도를 얼마나 더할지 */
+	UPROPERTY(EditAnywhere, Category = "Hazard|Knockback")
+	float InheritVelocityScale = 0.5f;
+
+	/** 위로 띄우는 속도 (cm/s) */
+	UPROPERTY(EditAnywhere, Category = "Hazard|Knockback")
+	float KnockbackUpSpeed = 350.f;
+
+	/** 같은 러너를 다시 밀쳐내기까지의 시간 (초) */
+	UPROPERTY(EditAnywhere, Category = "Hazard|Knockback", meta = (ClampMin = "0.0"))
+	float RehitCooldown = 0.4f;
+
+	/** 현재 월드 형상 (Segment 양 끝점. Sphere면 두 점이 같음) */
+	void GetWorldSegment(FVector& OutStart, FVector& OutEnd) const;
+
+protected:
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
+};
@@ -0,0 +1,254 @@
+#include "HazardSubsystem.h"
+#include "HazardComponent.h"
+#include "ObstacleAssualtCharacter.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/World.h"
+#include "Algo/BinarySearch.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarHazardCellSize(
+	TEXT("oa.Hazard.CellSize"),
+	400.f,
+	TEXT("위험 요소 공간 해시 셀 크기 (cm)"));
+
+namespace HazardHash
+{
+	/** 셀 좌표 3개를 21비트씩 묶은 키 */
+	static FORCEINLINE int64 MakeKey(int32 X, int32 Y, int32 Z)
+	{
+		const int64 Mask = (1 << 21) - 1;
+		return ((int64)(X & Mask) << 42) | ((int64)(Y & Mask) << 21) | (int64)(Z & Mask);
+	}
+
+	static FORCEINLINE FIntVector ToCell(const FVector& P, float InvCellSize)
+	{
+		return FIntVector(
+			FMath::FloorToInt(P.X * InvCellSize),
+			FMath::FloorToInt(P.Y * InvCellSize),
+			FMath::FloorToInt(P.Z * InvCellSize));
+	}
+
+	/** 경계 상자가 걸치는 모든 셀에 대해 Func(Key) 호출 */
+	template <typename FuncType>
+	static FORCEINLINE void ForEachCell(const FVector& Min, const FVector& Max, float InvCellSize, FuncType&& Func)
+	{
+		const FIntVector A = ToCell(Min, InvCellSize);
+		const FIntVector B = ToCell(Max, InvCellSize);
+		for (int32 X = A.X; X <= B.X; ++X)
+		{
+			for (int32 Y = A.Y; Y <= B.Y; ++Y)
+			{
+				for (int32 Z = A.Z; Z <= B.Z; ++Z)
+				{
+					Func(MakeKey(X, Y, Z));
+				}
+			}
+		}
+	}
+}
+
+bool UHazardSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UHazardSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UHazardSubsystem, STATGROUP_Tickables);
+}
+
+void UHazardSubsystem::RegisterHazard(UHazardComponent* Hazard)
+{
+	if (Hazard && !Hazards.Contains(Hazard))
+	{
+		Hazards.Add(Hazard);
+		bOrderDirty = true;
+	}
+}
+
+void UHazardSubsystem::UnregisterHazard(UHazardComponent* Hazard)
+{
+	const int32 Index = Hazards.Find(Hazard);
+	if (Index != INDEX_NONE)
+	{
+		Hazards.RemoveAt(Index);
+		Poses.Reset(); // 인덱스가 바뀌므로 이전 프레임 속도는 버림
+		bOrderDirty = true;
+	}
+
+	for (FRunnerEntry& Entry : Runners)
+	{
+		Entry.RecentHits.RemoveAll([Hazard](const FRecentHit& Hit) { return Hit.Hazard == Hazard; });
+	}
+}
+
+void UHazardSubsystem::RegisterRunner(AObstacleAssualtCharacter* Runner)
+{
+	if (!Runner) return;
+	if (Runners.ContainsByPredicate([Runner](const FRunnerEntry& E) { return E.Runner == Runner; })) return;
+
+	FRunnerEntry& Entry = Runners.AddDefaulted_GetRef();
+	Entry.Runner = Runner;
+	bOrderDirty = true;
+}
+
+void UHazardSubsystem::UnregisterRunner(AObstacleAssualtCharacter* Runner)
+{
+	Runners.RemoveAll([Runner](const FRunnerEntry& E) { return E.Runner == Runner; });
+}
+
+void UHazardSubsystem::SortIfDirty()
+{
+	if (!bOrderDirty) return;
+	bOrderDirty = false;
+
+	// 등록 순서(스폰 타이밍)에 의존하지 않도록 경로 이름으로 고정 정렬
+	Hazards.Sort([](const UHazardComponent& A, const UHazardComponent& B) { return A.GetPathName() < B.GetPathName(); });
+	Runners.Sort([](const FRunnerEntry& A, const FRunnerEntry& B) { return A.Runner->GetPathName() < B.Runner->GetPathName(); });
+	Poses.Reset();
+}
+
+void UHazardSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	LastContactCount = 0;
+	if (Hazards.Num() == 0 || Runners.Num() == 0) return;
+
+	SortIfDirty();
+
+	const float InvCellSize = 1.f / FMath::Max(50.f, CVarHazardCellSize.GetValueOnGameThread());
+	RebuildHash(DeltaTime, InvCellSize);
+
+	const float Now = GetWorld()->GetTimeSeconds();
+	for (FRunnerEntry& Entry : Runners)
+	{
+		if (ResolveRunner(Entry, InvCellSize, Now))
+		{
+			++LastContactCount;
+		}
+	}
+}
+
+void UHazardSubsystem::RebuildHash(float DeltaTime, float InvCellSize)
+{
+	const bool bHasPrevious = Poses.Num() == Hazards.Num();
+	Poses.SetNum(Hazards.Num());
+	Cells.Reset();
+
+	const float InvDelta = DeltaTime > KINDA_SMALL_NUMBER ? 1.f / DeltaTime : 0.f;
+
+	for (int32 i = 0; i < Hazards.Num(); ++i)
+	{
+		const UHazardComponent* Hazard = Hazards[i];
+		FHazardPose& Pose = Poses[i];
+
+		FVector Start, End;
+		Hazard->GetWorldSegment(Start, End);
+
+		// 위험 요소 속도는 이전 프레임 형상과의 차이로 구함 (물리 바디 필요 없음)
+		if (bHasPrevious && Pose.bValid)
+		{
+			Pose.StartVelocity = (Start - Pose.Start) * InvDelta;
+			Pose.EndVelocity = (End - Pose.End) * InvDelta;
+		}
+		else
+		{
+			Pose.StartVelocity = Pose.EndVelocity = FVector::ZeroVector;
+		}
+		Pose.Start = Start;
+		Pose.End = End;
+		Pose.bValid = true;
+
+		const FVector Extent(Hazard->Radius);
+		HazardHash::ForEachCell(Start.ComponentMin(End) - Extent, Start.ComponentMax(End) + Extent, InvCellSize,
+			[this, i](int64 Key) { Cells.Add({ Key, i }); });
+	}
+
+	Cells.Sort();
+}
+
+bool UHazardSubsystem::ResolveRunner(FRunnerEntry& Entry, float InvCellSize, float Now)
+{
+	AObstacleAssualtCharacter* Runner = Entry.Runner;
+
+	// 서버와 조종 중인 클라이언트에서만 판정 (시뮬레이트 프록시는 서버 결과를 복제받음)
+	if (!Runner->HasAuthority() && !Runner->IsLocallyControlled()) return false;
+
+	const UCapsuleComponent* Cap = Runner->GetCapsuleComponent();
+	if (!Cap) return false;
+
+	const float CapRadius = Cap->GetScaledCapsuleRadius();
+	const float CapHalfHeight = Cap->GetScaledCapsuleHalfHeight();
+	const FVector Center = Cap->GetComponentLocation();
+	const FVector CapA = Center - FVector(0.f, 0.f, CapHalfHeight - CapRadius);
+	const FVector CapB = Center + FVector(0.f, 0.f, CapHalfHeight - CapRadius);
+
+	// 캡슐이 걸친 셀에서 후보 수집
+	TArray<int32, TInlineAllocator<16>> Candidates;
+	HazardHash::ForEachCell(Center - FVector(CapRadius, CapRadius, CapHalfHeight), Center + FVector(CapRadius, CapRadius, CapHalfHeight), InvCellSize,
+		[this, &Candidates](int64 Key)
+		{
+			int32 Index = Algo::LowerBound(Cells, FCellEntry{ Key, 0 });
+			for (; Index < Cells.Num() && Cells[Index].Key == Key; ++Index)
+			{
+				Candidates.Add(Cells[Index].Hazard);
+			}
+		});
+
+	if (Candidates.Num() == 0) return false;
+
+	// 여러 셀에 걸친 위험 요소 중복 제거 + 인덱스 순서로 고정
+	Candidates.Sort();
+
+	Entry.RecentHits.RemoveAll([this, Now](const FRecentHit& Hit)
+	{
+		return Now - Hit.Time >= Hit.Hazard->RehitCooldown;
+	});
+
+	FVector Launch = FVector::ZeroVector;
+	bool bContact = false;
+	int32 Previous = INDEX_NONE;
+
+	for (int32 HazardIndex : Candidates)
+	{
+		if (HazardIndex == Previous) continue;
+		Previous = HazardIndex;
+
+		const UHazardComponent* Hazard = Hazards[HazardIndex];
+		if (Entry.RecentHits.ContainsByPredicate([Hazard](const FRecentHit& Hit) { return Hit.Hazard == Hazard; })) continue;
+
+		const FHazardPose& Pose = Poses[HazardIndex];
+
+		FVector HazardPoint, CapsulePoint;
+		FMath::SegmentDistToSegmentSafe(Pose.Start, Pose.End, CapA, CapB, HazardPoint, CapsulePoint);
+
+		const float ContactDistance = Hazard->Radius + CapRadius;
+		if (FVector::DistSquared(HazardPoint, CapsulePoint) > ContactDistance * ContactDistance) continue;
+
+		// 접촉 지점의 위험 요소 속도 (스위퍼 팔 끝일수록 빠름)
+		const float SegmentLength = FVector::Dist(Pose.Start, Pose.End);
+		const float T = SegmentLength > KINDA_SMALL_NUMBER ? FVector::Dist(Pose.Start, HazardPoint) / SegmentLength : 0.f;
+		const FVector HazardVelocity = FMath::Lerp(Pose.StartVelocity, Pose.EndVelocity, T);
+
+		// 수평 방향으로 밀어냄. 중심이 겹치면 위험 요소 진행 방향 사용
+		FVector Push = (CapsulePoint - HazardPoint) * FVector(1.f, 1.f, 0.f);
+		if (!Push.Normalize())
+		{
+			Push = (HazardVelocity * FVector(1.f, 1.f, 0.f)).GetSafeNormal();
+		}
+
+		Launch += Push * Hazard->KnockbackSpeed
+			+ HazardVelocity * FVector(1.f, 1.f, 0.f) * Hazard->InheritVelocityScale
+			+ FVector(0.f, 0.f, Hazard->KnockbackUpSpeed);
+
+		Entry.RecentHits.Add({ Hazard, Now });
+		bContact = true;
+	}
+
+	if (bContact)
+	{
+		Runner->ApplyHazardKnockback(Launch);
+	}
+	return bContact;
+}
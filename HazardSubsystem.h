@@ -0,0 +1,90 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "HazardSubsystem.generated.h"
+
+class UHazardComponent;
+class AObstacleAssualtCharacter;
+
+/**
+ *  위험 요소(UHazardComponent) ↔ 러너 캡슐 접촉 판정
+ *  매 프레임 위험 요소 형상을 균일 공간 해시(정렬된 셀 배열)에 넣고,
+ *  러너마다 자기 캡슐이 걸친 셀만 조회해 한 번에 판정한 뒤 넉백을 적용한다.
+ *  비용은 (위험 요소 수 + 러너 수)에 비례하고, 판정 순서는 경로 이름 기준으로 고정이라 결과가 결정적이다.
+ */
+UCLASS()
+class OBSTACLEASSUALT_API UHazardSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	void RegisterHazard(UHazardComponent* Hazard);
+	void UnregisterHazard(UHazardComponent* Hazard);
+
+	void RegisterRunner(AObstacleAssualtCharacter* Runner);
+	void UnregisterRunner(AObstacleAssualtCharacter* Runner);
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** 마지막 프레임에 넉백이 적용된 러너 수 */
+	int32 GetLastContactCount() const { return LastContactCount; }
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	/** 프레임마다 갱신되는 위험 요소 형상 */
+	struct FHazardPose
+	{
+		FVector Start = FVector::ZeroVector;
+		FVector End = FVector::ZeroVector;
+		FVector StartVelocity = FVector::ZeroVector;
+		FVector EndVelocity = FVector::ZeroVector;
+		bool bValid = false;
+	};
+
+	/** (셀 키, 위험 요소 인덱스) — 키 기준으로 정렬해 해시 버킷처럼 사용 */
+	struct FCellEntry
+	{
+		int64 Key;
+		int32 Hazard;
+
+		bool operator<(const FCellEntry& Other) const
+		{
+			return Key != Other.Key ? Key < Other.Key : Hazard < Other.Hazard;
+		}
+	};
+
+	struct FRecentHit
+	{
+		const UHazardComponent* Hazard;
+		float Time;
+	};
+
+	struct FRunnerEntry
+	{
+		AObstacleAssualtCharacter* Runner = nullptr;
+		TArray<FRecentHit, TInlineAllocator<4>> RecentHits;
+	};
+
+	void SortIfDirty();
+	void RebuildHash(float DeltaTime, float InvCellSize);
+
+	/** 러너 하나를 판정하고 넉백을 적용. 접촉했으면 true */
+	bool ResolveRunner(FRunnerEntry& Entry, float InvCellSize, float Now);
+
+	// 컴포넌트/러너는 제거될 때 반드시 Unregister 하므로 원시 포인터로 보관
+	TArray<UHazardComponent*> Hazards;
+	TArray<FHazardPose> Poses;
+	TArray<FRunnerEntry> Runners;
+
+	TArray<FCellEntry> Cells;
+
+	bool bOrderDirty = false;
+	int32 LastContactCount = 0;
+};
@@ -0,0 +1,230 @@
+#include "HitchRecorder.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "HAL/IConsoleManager.h"
+#include "Async/Async.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+#include "Serialization/MemoryWriter.h"
+#include "ObstacleAssualt.h"
+
+static TAutoConsoleVariable<int32> CVarHitchRecorderEnable(
+	TEXT("oa.HitchRecorder.Enable"),
+	1,
+	TEXT("히치 기록기 사용 여부 (0 = 끔)"));
+
+static TAutoConsoleVariable<float> CVarHitchRecorderThresholdMs(
+	TEXT("oa.HitchRecorder.ThresholdMs"),
+	50.f,
+	TEXT("이 값(ms)을 넘는 프레임이 나오면 링 버퍼를 덤프"));
+
+static TAutoConsoleVariable<int32> CVarHitchRecorderFrames(
+	TEXT("oa.HitchRecorder.Frames"),
+	300,
+	TEXT("링 버퍼에 유지할 프레임 수 (월드 시작 시 적용)"));
+
+static TAutoConsoleVariable<int32> CVarHitchRecorderPostFrames(
+	TEXT("oa.HitchRecorder.PostFrames"),
+	30,
+	TEXT("히치 이후 추가로 기록한 뒤 덤프할 프레임 수"));
+
+static TAutoConsoleVariable<float> CVarHitchRecorderMinInterval(
+	TEXT("oa.HitchRecorder.MinDumpInterval"),
+	5.f,
+	TEXT("자동 덤프 사이 최소 간격(초)"));
+
+static FAutoConsoleCommandWithWorld HitchRecorderDumpCommand(
+	TEXT("oa.HitchRecorder.Dump"),
+	TEXT("현재 히치 기록 링 버퍼를 디스크에 덤프"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (UHitchRecorderSubsystem* Recorder = UHitchRecorderSubsystem::Get(World))
+		{
+			Recorder->DumpNow(TEXT("Manual"));
+		}
+	}));
+
+namespace HitchRecorder
+{
+	static const uint32 FileMagic = 0x5248414F; // 'OAHR'
+	static const uint32 FileVersion = 1;
+
+	static const TCHAR* ScopeNames[(int32)EHitchScope::Count] =
+	{
+		TEXT("CharacterTick"),
+		TEXT("PlatformTick"),
+		TEXT("LedgeDetect"),
+		TEXT("ClimbSequence"),
+		TEXT("CourseInit"),
+	};
+
+	/** 덤프 파일 직렬화 (백그라운드 스레드에서 호출) */
+	static void WriteDump(const TArray<FHitchFrameRecord>& Records, float ThresholdMs, const FString& Reason, const FString& Path)
+	{
+		TArray<uint8> Bytes;
+		Bytes.Reserve(64 + Records.Num() * sizeof(FHitchFrameRecord));
+		FMemoryWriter Ar(Bytes);
+
+		uint32 Magic = FileMagic;
+		uint32 Version = FileVersion;
+		uint32 NumScopes = (uint32)EHitchScope::Count;
+		uint32 NumRecords = (uint32)Records.Num();
+		Ar << Magic << Version << NumScopes << NumRecords << ThresholdMs;
+
+		for (const TCHAR* Name : ScopeNames)
+		{
+			FTCHARToUTF8 Utf8(Name);
+			uint8 Len = (uint8)Utf8.Length();
+			Ar << Len;
+			Ar.Serialize((void*)Utf8.Get(), Len);
+		}
+
+		FTCHARToUTF8 ReasonUtf8(*Reason);
+		uint8 ReasonLen = (uint8)FMath::Min(ReasonUtf8.Length(), 255);
+		Ar << ReasonLen;
+		Ar.Serialize((void*)ReasonUtf8.Get(), ReasonLen);
+
+		for (FHitchFrameRecord Record : Records)
+		{
+			Ar << Record.FrameNumber << Record.FrameStartSeconds << Record.FrameMs;
+			for (float& ScopeMs : Record.ScopeMs)
+			{
+				Ar << ScopeMs;
+			}
+			Ar << Record.TimeDilation << Record.PlatformsUpdated << Record.bSlowMo << Record.ClimbEvents;
+		}
+
+		if (!FFileHelper::SaveArrayToFile(Bytes, *Path))
+		{
+			UE_LOG(LogObstacleAssualt, Warning, TEXT("HitchRecorder: failed to write %s"), *Path);
+		}
+	}
+}
+
+UHitchRecorderSubsystem* UHitchRecorderSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UHitchRecorderSubsystem>() : nullptr;
+}
+
+bool UHitchRecorderSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UHitchRecorderSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// 기록 중에는 할당이 일어나지 않도록 링 버퍼를 미리 잡아 둔다
+	Ring.SetNum(FMath::Clamp(CVarHitchRecorderFrames.GetValueOnGameThread(), 16, 4096));
+	Head = 0;
+	NumValid = 0;
+	LastFrameCycles = FPlatformTime::Cycles64();
+
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UHitchRecorderSubsystem::OnWorldPostActorTick);
+}
+
+void UHitchRecorderSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+
+	Super::Deinitialize();
+}
+
+void UHitchRecorderSubsystem::OnWorldPostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds)
+{
+	if (InWorld != GetWorld()) return;
+
+	const uint64 NowCycles = FPlatformTime::Cycles64();
+	const float FrameMs = (float)FPlatformTime::ToMilliseconds64(NowCycles - LastFrameCycles);
+	LastFrameCycles = NowCycles;
+
+	if (CVarHitchRecorderEnable.GetValueOnGameThread() == 0)
+	{
+		Current = FCurrentFrame();
+		return;
+	}
+
+	CommitFrame(FrameMs);
+
+	// 히치 감지 → 이후 몇 프레임까지 모은 뒤 덤프
+	if (PendingDumpFrames < 0 && FrameMs > CVarHitchRecorderThresholdMs.GetValueOnGameThread())
+	{
+		const double Now = FPlatformTime::Seconds();
+		if (Now - LastDumpSeconds >= CVarHitchRecorderMinInterval.GetValueOnGameThread())
+		{
+			PendingDumpFrames = FMath::Max(0, CVarHitchRecorderPostFrames.GetValueOnGameThread());
+			PendingDumpReason = FString::Printf(TEXT("Hitch %.1fms frame %llu"), FrameMs, (uint64)GFrameCounter);
+		}
+	}
+
+	if (PendingDumpFrames >= 0 && PendingDumpFrames-- == 0)
+	{
+		DumpNow(PendingDumpReason);
+		PendingDumpFrames = -1;
+	}
+}
+
+void UHitchRecorderSubsystem::CommitFrame(float FrameMs)
+{
+	FHitchFrameRecord& Record = Ring[Head];
+	Record.FrameNumber = GFrameCounter;
+	Record.FrameStartSeconds = FPlatformTime::Seconds() - FrameMs * 0.001;
+	Record.FrameMs = FrameMs;
+	for (int32 i = 0; i < (int32)EHitchScope::Count; ++i)
+	{
+		Record.ScopeMs[i] = (float)FPlatformTime::ToMilliseconds64(Current.ScopeCycles[i]);
+	}
+
+	const AWorldSettings* WorldSettings = GetWorld() ? GetWorld()->GetWorldSettings() : nullptr;
+	Record.TimeDilation = WorldSettings ? WorldSettings->GetEffectiveTimeDilation() : 1.f;
+	Record.PlatformsUpdated = Current.PlatformsUpdated;
+	Record.bSlowMo = Current.bSlowMo;
+	Record.ClimbEvents = Current.ClimbEvents;
+
+	Head = (Head + 1) % Ring.Num();
+	NumValid = FMath::Min(NumValid + 1, Ring.Num());
+
+	// 슬로우 상태는 캐릭터가 바꿀 때까지 유지
+	const uint8 bSlowMo = Current.bSlowMo;
+	Current = FCurrentFrame();
+	Current.bSlowMo = bSlowMo;
+}
+
+void UHitchRecorderSubsystem::DumpNow(const FString& Reason)
+{
+	if (NumValid == 0) return;
+
+	if (*bDumpInFlight)
+	{
+		UE_LOG(LogObstacleAssualt, Verbose, TEXT("HitchRecorder: dump already in flight, skipping (%s)"), *Reason);
+		return;
+	}
+
+	// 오래된 프레임부터 순서대로 복사 (게임 스레드 비용은 memcpy 수준)
+	TArray<FHitchFrameRecord> Snapshot;
+	Snapshot.Reserve(NumValid);
+	const int32 First = (Head - NumValid + Ring.Num()) % Ring.Num();
+	for (int32 i = 0; i < NumValid; ++i)
+	{
+		Snapshot.Add(Ring[(First + i) % Ring.Num()]);
+	}
+
+	LastDumpSeconds = FPlatformTime::Seconds();
+
+	const FString Path = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Profiling"), TEXT("Hitches"),
+		FString::Printf(TEXT("Hitch_%s_%llu.oahr"), *FDateTime::Now().ToString(), (uint64)GFrameCounter));
+	const float ThresholdMs = CVarHitchRecorderThresholdMs.GetValueOnGameThread();
+
+	UE_LOG(LogObstacleAssualt, Log, TEXT("HitchRecorder: dumping %d frames to %s (%s)"), Snapshot.Num(), *Path, *Reason);
+
+	*bDumpInFlight = true;
+	TSharedRef<FThreadSafeBool, ESPMode::ThreadSafe> InFlight = bDumpInFlight;
+	Async(EAsyncExecution::ThreadPool, [Records = MoveTemp(Snapshot), ThresholdMs, Reason, Path, InFlight]()
+	{
+		HitchRecorder::WriteDump(Records, ThresholdMs, Reason, Path);
+		*InFlight = false;
+	});
+}
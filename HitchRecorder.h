@@ -0,0 +1,134 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "HitchRecorder.generated.h"
+
+/** 프레임마다 시간을 누적하는 게임플레이 구간 */
+enum class EHitchScope : uint8
+{
+	CharacterTick,
+	PlatformTick,
+	LedgeDetect,
+	ClimbSequence,
+	CourseInit,
+
+	Count
+};
+
+/** 등반 시퀀스 이벤트 (프레임당 비트로 기록) */
+enum class EHitchClimbEvent : uint8
+{
+	None        = 0,
+	AutoClimb   = 1 << 0,
+	ClimbStart  = 1 << 1,
+	ClimbCommit = 1 << 2,
+	ClimbFinish = 1 << 3,
+	Drop        = 1 << 4,
+};
+ENUM_CLASS_FLAGS(EHitchClimbEvent)
+
+/** 링 버퍼에 저장되는 한 프레임 기록 */
+struct FHitchFrameRecord
+{
+	uint64 FrameNumber = 0;
+	double FrameStartSeconds = 0.0;
+	float  FrameMs = 0.f;
+	float  ScopeMs[(int32)EHitchScope::Count] = {};
+	float  TimeDilation = 1.f;
+	uint16 PlatformsUpdated = 0;
+	uint8  bSlowMo = 0;
+	uint8  ClimbEvents = 0;
+};
+
+/**
+ *  항상 켜져 있는 히치 기록기
+ *  최근 N프레임을 링 버퍼에 유지하다가 임계값을 넘는 프레임이 나오면
+ *  백그라운드 스레드에서 버퍼를 Saved/Profiling/Hitches 에 덤프한다.
+ *  덤프는 Tools/hitch_timeline.py 로 타임라인(JSON)으로 변환한다.
+ */
+UCLASS()
+class OBSTACLEASSUALT_API UHitchRecorderSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** 월드에서 기록기를 찾는다 (없으면 nullptr) */
+	static UHitchRecorderSubsystem* Get(const UObject* WorldContextObject);
+
+	FORCEINLINE void AddScopeCycles(EHitchScope Scope, uint64 Cycles) { Current.ScopeCycles[(int32)Scope] += Cycles; }
+	FORCEINLINE void NotePlatformUpdated() { ++Current.PlatformsUpdated; }
+	FORCEINLINE void NoteClimbEvent(EHitchClimbEvent Event) { Current.ClimbEvents |= (uint8)Event; }
+	FORCEINLINE void NoteSlowMo(bool bSlowMo) { Current.bSlowMo = bSlowMo ? 1 : 0; }
+
+	/** 현재 링 버퍼를 즉시 덤프 (콘솔: oa.HitchRecorder.Dump) */
+	void DumpNow(const FString& Reason);
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	/** 진행 중인 프레임의 누적값 */
+	struct FCurrentFrame
+	{
+		uint64 ScopeCycles[(int32)EHitchScope::Count] = {};
+		uint16 PlatformsUpdated = 0;
+		uint8  bSlowMo = 0;
+		uint8  ClimbEvents = 0;
+	};
+
+	void OnWorldPostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds);
+
+	/** 프레임을 닫아 링 버퍼에 넣는다 */
+	void CommitFrame(float FrameMs);
+
+	TArray<FHitchFrameRecord> Ring;
+	int32 Head = 0;
+	int32 NumValid = 0;
+
+	FCurrentFrame Current;
+
+	uint64 LastFrameCycles = 0;
+	double LastDumpSeconds = -1000.0;
+
+	/** 히치 이후 몇 프레임 더 모은 뒤 덤프할지 (남은 프레임 수, -1 = 대기 없음) */
+	int32 PendingDumpFrames = -1;
+	FString PendingDumpReason;
+
+	/** 백그라운드 덤프가 진행 중인지 (서브시스템보다 오래 살 수 있음) */
+	TSharedRef<FThreadSafeBool, ESPMode::ThreadSafe> bDumpInFlight = MakeShared<FThreadSafeBool, ESPMode::ThreadSafe>(false);
+
+	FDelegateHandle PostActorTickHandle;
+};
+
+/** 스코프 시간을 기록기에 더하는 RAII 헬퍼. 기록기가 없으면 아무것도 하지 않는다. */
+struct FHitchScope
+{
+	FORCEINLINE FHitchScope(UHitchRecorderSubsystem* InRecorder, EHitchScope InScope)
+		: Recorder(InRecorder)
+		, Scope(InScope)
+		, StartCycles(InRecorder ? FPlatformTime::Cycles64() : 0)
+	{
+	}
+
+	FORCEINLINE ~FHitchScope()
+	{
+		if (Recorder)
+		{
+			Recorder->AddScopeCycles(Scope, FPlatformTime::Cycles64() - StartCycles);
+		}
+	}
+
+private:
+	UHitchRecorderSubsystem* Recorder;
+	EHitchScope Scope;
+	uint64 StartCycles;
+};
@@ -0,0 +1,323 @@
+#include "InputLatencyComponent.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/CameraComponent.h"
+#include "Camera/PlayerCameraManager.h"
+#include "GameFramework/SpringArmComponent.h"
+#include "CameraOcclusionComponent.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CoreDelegates.h"
+#include "RenderingThread.h"
+#include "ObstacleAssualt.h"
+
+namespace InputLatency
+{
+	static const TCHAR* ActionNames[(int32)EInputLatencyAction::Count] = { TEXT("Move"), TEXT("Look"), TEXT("Jump"), TEXT("SlowMo") };
+	static const TCHAR* StageNames[(int32)EInputLatencyStage::Count] = { TEXT("Applied"), TEXT("FrameEnd"), TEXT("RenderThread") };
+
+	static UInputLatencyComponent* FindLocal(UWorld* World)
+	{
+		APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+		APawn* Pawn = PC ? PC->GetPawn() : nullptr;
+		return Pawn ? Pawn->FindComponentByClass<UInputLatencyComponent>() : nullptr;
+	}
+}
+
+void FInputLatencyHistogram::Add(double Milliseconds, int32 Frames)
+{
+	int32 MsBucket = 0;
+	for (double Upper = 1.0; MsBucket < NumMsBuckets - 1 && Milliseconds >= Upper; Upper *= 2.0)
+	{
+		++MsBucket;
+	}
+	MsBuckets[MsBucket].fetch_add(1, std::memory_order_relaxed);
+	FrameBuckets[FMath::Clamp(Frames, 0, NumFrameBuckets - 1)].fetch_add(1, std::memory_order_relaxed);
+	Count.fetch_add(1, std::memory_order_relaxed);
+
+	// 최대값은 경쟁이 드물어 CAS 반복으로 충분
+	const int32 Micro = (int32)FMath::Min(Milliseconds * 1000.0, (double)MAX_int32);
+	for (int32 Old = MaxMicroseconds.load(); Micro > Old && !MaxMicroseconds.compare_exchange_weak(Old, Micro);)
+	{
+	}
+	for (int32 Old = MaxFrames.load(); Frames > Old && !MaxFrames.compare_exchange_weak(Old, Frames);)
+	{
+	}
+}
+
+void FInputLatencyHistogram::Reset()
+{
+	for (std::atomic<int32>& Bucket : MsBuckets) Bucket = 0;
+	for (std::atomic<int32>& Bucket : FrameBuckets) Bucket = 0;
+	Count = 0;
+	MaxFrames = 0;
+	MaxMicroseconds = 0;
+}
+
+float FInputLatencyHistogram::PercentileMs(float Percentile) const
+{
+	const int32 Total = Count.load();
+	if (Total == 0) return 0.f;
+
+	const int32 Threshold = FMath::CeilToInt(Total * FMath::Clamp(Percentile, 0.f, 1.f));
+	int32 Seen = 0;
+	float Upper = 1.f;
+	for (int32 i = 0; i < NumMsBuckets; ++i, Upper *= 2.f)
+	{
+		Seen += MsBuckets[i].load();
+		if (Seen >= Threshold)
+		{
+			return i == NumMsBuckets - 1 ? MaxMicroseconds.load() * 0.001f : Upper;
+		}
+	}
+	return MaxMicroseconds.load() * 0.001f;
+}
+
+FString FInputLatencyHistogram::ToString() const
+{
+	FString Frames;
+	for (int32 i = 0; i < NumFrameBuckets; ++i)
+	{
+		Frames += FString::Printf(TEXT("%s%d%s:%d"), i ? TEXT(" ") : TEXT(""), i, i == NumFrameBuckets - 1 ? TEXT("+") : TEXT(""), FrameBuckets[i].load());
+	}
+	return FString::Printf(TEXT("n=%d p50<=%.0fms p95<=%.0fms max=%.2fms maxFrames=%d [frames %s]"),
+		Count.load(), PercentileMs(0.5f), PercentileMs(0.95f), MaxMicroseconds.load() * 0.001f, MaxFrames.load(), *Frames);
+}
+
+UInputLatencyComponent::UInputLatencyComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	// 캐릭터 이동 컴포넌트가 입력을 소비한 뒤
+	PrimaryComponentTick.TickGroup = TG_PostPhysics;
+
+	for (auto& ActionHistograms : Histograms)
+	{
+		for (auto& Histogram : ActionHistograms)
+		{
+			Histogram = MakeShared<FInputLatencyHistogram, ESPMode::ThreadSafe>();
+		}
+	}
+}
+
+void UInputLatencyComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// 서버에는 로컬 입력이 없음
+	if (IsNetMode(NM_DedicatedServer))
+	{
+		SetComponentTickEnabled(false);
+		return;
+	}
+
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &UInputLatencyComponent::OnEndFrame);
+
+	RegisterLateLookTick(bLateLookSampling);
+}
+
+void UInputLatencyComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+
+	RegisterLateLookTick(false);
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UInputLatencyComponent::SetLateLookSampling(bool bEnable)
+{
+	bLateLookSampling = bEnable;
+	if (HasBegunPlay() && !IsNetMode(NM_DedicatedServer))
+	{
+		RegisterLateLookTick(bEnable);
+	}
+}
+
+void UInputLatencyComponent::RegisterLateLookTick(bool bRegister)
+{
+	if (bRegister == LateLookTick.IsTickFunctionRegistered()) return;
+
+	if (bRegister)
+	{
+		// UWorld::Tick 은 TG_PostPhysics 가 끝난 뒤 UpdateCameraManager 를 돌고 나서 TG_PostUpdateWork 로 넘어간다.
+		// 그래서 이동(TG_PrePhysics)이 끝난 PostPhysics 에서 적용하고, 같은 그룹에서 컨트롤 회전을 읽는 컴포넌트는 그 뒤로
+		LateLookTick.Target = this;
+		LateLookTick.TickGroup = TG_PostPhysics;
+		LateLookTick.bCanEverTick = true;
+		LateLookTick.RegisterTickFunction(GetComponentLevel());
+		LinkLateLookDependents(true);
+	}
+	else
+	{
+		// 모아 둔 입력은 버리지 않고 지금 적용
+		ApplyLateLook(0.f);
+		LinkLateLookDependents(false);
+		LateLookTick.UnRegisterTickFunction();
+	}
+}
+
+void UInputLatencyComponent::LinkLateLookDependents(bool bLink)
+{
+	AActor* Owner = GetOwner();
+	if (!Owner) return;
+
+	// 스프링암은 자기 틱에서 컨트롤 회전으로 카메라 위치를 정하고, 차폐 탐지는 그 회전으로 다음 스윕을 건다
+	TInlineComponentArray<UActorComponent*> Components(Owner);
+	for (UActorComponent* Component : Components)
+	{
+		if (!Component->IsA<USpringArmComponent>() && !Component->IsA<UCameraComponent>() && !Component->IsA<UCameraOcclusionComponent>()) continue;
+
+		if (bLink)
+		{
+			Component->PrimaryComponentTick.AddPrerequisite(this, LateLookTick);
+		}
+		else
+		{
+			Component->PrimaryComponentTick.RemovePrerequisite(this, LateLookTick);
+		}
+	}
+}
+
+void UInputLatencyComponent::MarkInput(EInputLatencyAction Action)
+{
+	FPendingInput& Pending = AwaitingApplied[(int32)Action];
+	if (Pending.bPending) return;
+
+	Pending.Cycles = FPlatformTime::Cycles64();
+	Pending.Frame = GFrameCounter;
+	Pending.bPending = true;
+}
+
+bool UInputLatencyComponent::BufferLook(float Yaw, float Pitch)
+{
+	if (!bLateLookSampling || !LateLookTick.IsTickFunctionRegistered()) return false;
+
+	PendingYaw += Yaw;
+	PendingPitch += Pitch;
+	bHasPendingLook = true;
+	return true;
+}
+
+void UInputLatencyComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	const uint64 Now = FPlatformTime::Cycles64();
+	for (int32 a = 0; a < (int32)EInputLatencyAction::Count; ++a)
+	{
+		// 늦은 시야 입력은 실제 적용 시점(ApplyLateLook)에서 기록
+		if (a == (int32)EInputLatencyAction::Look && bHasPendingLook) continue;
+
+		FPendingInput& Pending = AwaitingApplied[a];
+		if (!Pending.bPending) continue;
+
+		Histograms[a][(int32)EInputLatencyStage::Applied]->Add(FPlatformTime::ToMilliseconds64(Now - Pending.Cycles), (int32)(GFrameCounter - Pending.Frame));
+		AwaitingFrameEnd[a] = Pending;
+		Pending.bPending = false;
+	}
+}
+
+void UInputLatencyComponent::FLateLookTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Target && IsValid(Target))
+	{
+		Target->ApplyLateLook(DeltaTime);
+	}
+}
+
+void UInputLatencyComponent::ApplyLateLook(float DeltaTime)
+{
+	if (!bHasPendingLook) return;
+	bHasPendingLook = false;
+
+	const APawn* Pawn = Cast<APawn>(GetOwner());
+	APlayerController* PC = Pawn ? Cast<APlayerController>(Pawn->GetController()) : nullptr;
+	if (PC && !PC->IsLookInputIgnored())
+	{
+		// AddYawInput/AddPitchInput 으로 컨트롤러와 같은 입력 배율(레거시 InputYawScale/InputPitchScale, 피치 부호)을
+		// 거친 값만 꺼내 쓰고 RotationInput 은 되돌린다. 이후는 APlayerController::UpdateRotation 과 같은 경로 (피치 제한 포함)
+		const FRotator SavedRotationInput = PC->RotationInput;
+		PC->AddYawInput(PendingYaw);
+		PC->AddPitchInput(PendingPitch);
+		FRotator DeltaRot = PC->RotationInput - SavedRotationInput;
+		PC->RotationInput = SavedRotationInput;
+
+		FRotator ViewRotation = PC->GetControlRotation();
+		if (PC->PlayerCameraManager)
+		{
+			PC->PlayerCameraManager->ProcessViewRotation(DeltaTime, ViewRotation, DeltaRot);
+		}
+		else
+		{
+			ViewRotation += DeltaRot;
+		}
+		PC->SetControlRotation(ViewRotation);
+	}
+	PendingYaw = 0.f;
+	PendingPitch = 0.f;
+
+	FPendingInput& Pending = AwaitingApplied[(int32)EInputLatencyAction::Look];
+	if (Pending.bPending)
+	{
+		Histograms[(int32)EInputLatencyAction::Look][(int32)EInputLatencyStage::Applied]->Add(
+			FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - Pending.Cycles), (int32)(GFrameCounter - Pending.Frame));
+		AwaitingFrameEnd[(int32)EInputLatencyAction::Look] = Pending;
+		Pending.bPending = false;
+	}
+}
+
+void UInputLatencyComponent::OnEndFrame()
+{
+	const uint64 Now = FPlatformTime::Cycles64();
+	for (int32 a = 0; a < (int32)EInputLatencyAction::Count; ++a)
+	{
+		FPendingInput& Pending = AwaitingFrameEnd[a];
+		if (!Pending.bPending) continue;
+		Pending.bPending = false;
+
+		Histograms[a][(int32)EInputLatencyStage::FrameEnd]->Add(FPlatformTime::ToMilliseconds64(Now - Pending.Cycles), (int32)(GFrameCounter - Pending.Frame));
+
+		// 렌더 스레드가 이 프레임의 명령을 처리하는 시점
+		TSharedPtr<FInputLatencyHistogram, ESPMode::ThreadSafe> RenderHistogram = Histograms[a][(int32)EInputLatencyStage::RenderThread];
+		const uint64 InputCycles = Pending.Cycles;
+		const uint64 InputFrame = Pending.Frame;
+		ENQUEUE_RENDER_COMMAND(InputLatencyMark)([RenderHistogram, InputCycles, InputFrame](FRHICommandListImmediate&)
+		{
+			RenderHistogram->Add(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - InputCycles), (int32)(GFrameCounterRenderThread - InputFrame));
+		});
+	}
+}
+
+void UInputLatencyComponent::ResetHistograms()
+{
+	for (auto& ActionHistograms : Histograms)
+	{
+		for (auto& Histogram : ActionHistograms)
+		{
+			Histogram->Reset();
+		}
+	}
+}
+
+void UInputLatencyComponent::DumpToLog() const
+{
+	for (int32 a = 0; a < (int32)EInputLatencyAction::Count; ++a)
+	{
+		for (int32 s = 0; s < (int32)EInputLatencyStage::Count; ++s)
+		{
+			UE_LOG(LogObstacleAssualt, Display, TEXT("InputLatency %-6s %-12s %s"), InputLatency::ActionNames[a], InputLatency::StageNames[s], *Histograms[a][s]->ToString());
+		}
+	}
+}
+
+static FAutoConsoleCommandWithWorld InputLatencyDumpCommand(
+	TEXT("oa.InputLatency.Dump"),
+	TEXT("로컬 플레이어의 입력 지연 히스토그램 출력"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (UInputLatencyComponent* Latency = InputLatency::FindLocal(World))
+		{
+			Latency->DumpToLog();
+		}
+	}));
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include <atomic>
+#include "InputLatencyComponent.generated.h"
+
+/** 계측 대상 입력 */
+enum class EInputLatencyAction : uint8
+{
+	Move,
+	Look,
+	Jump,
+	SlowMo,
+
+	Count
+};
+
+/** 입력 → 각 단계까지의 구간 */
+enum class EInputLatencyStage : uint8
+{
+	/** 입력 이벤트 → 이동/회전이 반영된 시점 (PostPhysics) */
+	Applied,
+	/** 입력 이벤트 → 게임 스레드 프레임 종료 */
+	FrameEnd,
+	/** 입력 이벤트 → 렌더 스레드가 해당 프레임을 처리 */
+	RenderThread,
+
+	Count
+};
+
+/**
+ *  지연 시간 히스토그램 (ms는 2의 거듭제곱 버킷, 프레임 수는 0~4+)
+ *  렌더 스레드에서도 기록하므로 카운터는 스레드 안전
+ */
+struct OBSTACLEASSUALT_API FInputLatencyHistogram
+{
+	static constexpr int32 NumMsBuckets = 10;     // [0,1) [1,2) [2,4) ... [256,inf)
+	static constexpr int32 NumFrameBuckets = 5;   // 0, 1, 2, 3, 4+
+
+	std::atomic<int32> MsBuckets[NumMsBuckets] = {};
+	std::atomic<int32> FrameBuckets[NumFrameBuckets] = {};
+	std::atomic<int32> Count{ 0 };
+	std::atomic<int32> MaxFrames{ 0 };
+	std::atomic<int32> MaxMicroseconds{ 0 };
+
+	void Add(double Milliseconds, int32 Frames);
+	void Reset();
+
+	/** 백분위 근사 (버킷 상한 ms) */
+	float PercentileMs(float Percentile) const;
+
+	FString ToString() const;
+};
+
+/**
+ *  입력 지연 계측 + 늦은 시점 시야 입력 적용
+ *  DoMove/DoLook/DoJumpStart/StartSlowMo 에서 MarkInput 으로 시각을 찍고
+ *  이동 반영(PostPhysics) / 프레임 종료 / 렌더 스레드 처리 시점까지의 지연을 기록한다.
+ */
+UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
+class OBSTACLEASSUALT_API UInputLatencyComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UInputLatencyComponent();
+
+	/** 입력 이벤트 시각 기록 (같은 프레임 안의 중복 입력은 첫 번째만) */
+	void MarkInput(EInputLatencyAction Action);
+
+	/**
+	 *  true면 시야 입력을 즉시 컨트롤러에 넣지 않고 모아 두었다가
+	 *  이동이 끝난 TG_PostPhysics 에서, 컨트롤 회전을 읽는 스프링암/카메라보다 먼저 한 번에 적용한다.
+	 *  (카메라 매니저는 TG_PostPhysics 와 TG_PostUpdateWork 사이에 갱신되므로 그보다 늦으면 한 프레임 밀린다)
+	 */
+	UPROPERTY(EditAnywhere, Category = "Input|Latency")
+	bool bLateLookSampling = false;
+
+	/** 실행 중 전환 (BeginPlay 전이면 값만 바꿈). 끌 때 모아 둔 시야 입력은 바로 적용 */
+	void SetLateLookSampling(bool bEnable);
+
+	/** bLateLookSampling 일 때 DoLook 에서 호출 (AddControllerYawInput/PitchInput 에 넘길 값 그대로). 처리했으면 true */
+	bool BufferLook(float Yaw, float Pitch);
+
+	const FInputLatencyHistogram& GetHistogram(EInputLatencyAction Action, EInputLatencyStage Stage) const
+	{
+		return *Histograms[(int32)Action][(int32)Stage];
+	}
+
+	void ResetHistograms();
+
+	/** 모든 히스토그램을 로그로 출력 (콘솔: oa.InputLatency.Dump) */
+	void DumpToLog() const;
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+private:
+	struct FPendingInput
+	{
+		uint64 Cycles = 0;
+		uint64 Frame = 0;
+		bool bPending = false;
+	};
+
+	/** 모아 둔 시야 입력을 적용하는 보조 틱 (TG_PostPhysics, 스프링암/카메라의 선행 조건) */
+	struct FLateLookTickFunction : public FTickFunction
+	{
+		UInputLatencyComponent* Target = nullptr;
+
+		virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+		virtual FString DiagnosticMessage() override { return TEXT("UInputLatencyComponent::LateLook"); }
+	};
+
+	void ApplyLateLook(float DeltaTime);
+	void RegisterLateLookTick(bool bRegister);
+
+	/** 컨트롤 회전을 읽는 소유 액터의 컴포넌트들이 LateLookTick 뒤에 돌도록 선행 조건을 걸거나 푼다 */
+	void LinkLateLookDependents(bool bLink);
+	void OnEndFrame();
+
+	/** 단계별 대기 중인 입력 */
+	FPendingInput AwaitingApplied[(int32)EInputLatencyAction::Count];
+	FPendingInput AwaitingFrameEnd[(int32)EInputLatencyAction::Count];
+
+	/** 렌더 스레드에서 기록하므로 컴포넌트가 사라져도 살아 있도록 공유 포인터 */
+	TSharedPtr<FInputLatencyHistogram, ESPMode::ThreadSafe> Histograms[(int32)EInputLatencyAction::Count][(int32)EInputLatencyStage::Count];
+
+	FLateLookTickFunction LateLookTick;
+	float PendingYaw = 0.f;
+	float PendingPitch = 0.f;
+	bool bHasPendingLook = false;
+
+	FDelegateHandle EndFrameHandle;
+};
@@ -0,0 +1,443 @@
+#include "InputLatencyComponent.h"
+#include "ObstacleAssualtCharacter.h"
+#include "ObstacleAssualtGameState.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/World.h"
+#include "EnhancedInputSubsystems.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/WorldSettings.h"
+#include "GameMapsSettings.h"
+#include "InputAction.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// 입력 → 화면 반영 프레임 상한 검사 (헤드리스):
+//   UnrealEditor ObstacleAssualt.uproject -game -nullrhi -nosound -unattended
+//     -ExecCmds="Automation RunTests ObstacleAssualt.InputLatency" -TestExit="Automation Test Queue Empty"
+// 상한을 넘으면 테스트가 실패하고 프로세스가 0이 아닌 코드로 끝난다.
+
+namespace InputLatencyTest
+{
+	/** 입력 주입 프레임 → 카메라/슬로우 반영 프레임 상한 */
+	static constexpr int32 MaxFrames = 1;
+
+	/** 서버(GameState)는 요청을 다음 자기 틱에 합쳐 반영하므로 목표 딜레이션은 한 프레임 더 허용 */
+	static constexpr int32 MaxDilationFrames = MaxFrames + 1;
+
+	static constexpr int32 NumLooks = 20;
+	static constexpr int32 NumSlowMoPresses = 3;
+
+	/** 슬로우 누름/뗌 유지 시간 (실시간 초). oa.TimeDilation.MinInterval + RequestInterval 보다 길게 */
+	static constexpr double SlowMoHoldSeconds = 0.5;
+
+	static constexpr double TimeoutSeconds = 30.0;
+
+	/** 즉시 적용과 늦은 시야 샘플링의 입력당 회전 차이 허용 (비율) */
+	static constexpr double LookResponseTolerance = 0.05;
+
+	/** 주입한 시야 입력 한 번당 컨트롤 회전 변화 (피치는 주입 부호를 곱해 누적) */
+	struct FLookResponse
+	{
+		double Yaw = 0.0;
+		double Pitch = 0.0;
+		int32 Count = 0;
+
+		double MeanYaw() const { return Count > 0 ? Yaw / Count : 0.0; }
+		double MeanPitch() const { return Count > 0 ? Pitch / Count : 0.0; }
+	};
+
+	/** 입력 처리(PrePhysics)가 끝난 뒤 월드 틱 중간에 도는 콜백. 입력이 프레임 한가운데 도착한 최악의 경우 */
+	struct FMidFrameTickFunction : public FTickFunction
+	{
+		TFunction<void()> Callback;
+
+		virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override
+		{
+			if (Callback) Callback();
+		}
+		virtual FString DiagnosticMessage() override { return TEXT("InputLatencyTest::MidFrame"); }
+	};
+
+	/** 서버가 정한 목표 딜레이션 (관리자가 없으면 월드 값) */
+	static float GetRequestedDilation(const UWorld* World)
+	{
+		if (const AObstacleAssualtGameState* GameState = World->GetGameState<AObstacleAssualtGameState>())
+		{
+			return GameState->GetTimeDilationState().Target;
+		}
+		const AWorldSettings* Settings = World->GetWorldSettings();
+		return Settings ? Settings->TimeDilation : 1.f;
+	}
+}
+
+/**
+ *  로컬 캐릭터에 Enhanced Input 으로 시야/슬로우 입력을 프레임 중간에 주입하고
+ *  카메라 회전과 슬로우 상태가 몇 프레임 뒤에 바뀌는지 잰다 (카메라는 카메라 매니저 갱신 뒤에 확인).
+ */
+class FInputLatencyProbeCommand : public IAutomationLatentCommand
+{
+public:
+	FInputLatencyProbeCommand(FAutomationTestBase* InTest, bool bInLateLook, TSharedRef<InputLatencyTest::FLookResponse> InLookResponse)
+		: Test(InTest)
+		, bLateLook(bInLateLook)
+		, LookResponse(InLookResponse)
+	{
+	}
+
+	virtual ~FInputLatencyProbeCommand() override
+	{
+		Finish();
+	}
+
+	virtual bool Update() override
+	{
+		if (Phase == EPhase::Setup)
+		{
+			if (!Setup())
+			{
+				if (GetCurrentRunTime() < 10.0) return false;
+
+				Test->AddError(TEXT("No locally controlled AObstacleAssualtCharacter with Look/SlowMo actions and an Enhanced Input subsystem"));
+				return true;
+			}
+			Phase = EPhase::Look;
+		}
+
+		if (Phase == EPhase::Done)
+		{
+			Report();
+			Finish();
+			return true;
+		}
+
+		if (GetCurrentRunTime() > InputLatencyTest::TimeoutSeconds)
+		{
+			Test->AddError(FString::Printf(TEXT("Timed out (late look %d): %d/%d looks, %d/%d slow-mo presses measured"),
+				bLateLook, LookDelays.Num(), InputLatencyTest::NumLooks, SlowMoPresses, InputLatencyTest::NumSlowMoPresses));
+			Finish();
+			return true;
+		}
+		return false;
+	}
+
+private:
+	enum class EPhase : uint8
+	{
+		Setup,
+		Look,
+		SlowMoHold,
+		SlowMoRelease,
+		Done,
+	};
+
+	bool Setup()
+	{
+		World = AutomationCommon::GetAnyGameWorld();
+		APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+		Character = PC ? Cast<AObstacleAssualtCharacter>(PC->GetPawn()) : nullptr;
+		UInputLatencyComponent* Latency = Character.IsValid() ? Character->GetInputLatency() : nullptr;
+		ULocalPlayer* LocalPlayer = PC ? PC->GetLocalPlayer() : nullptr;
+		UEnhancedInputLocalPlayerSubsystem* Input = LocalPlayer ? ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(LocalPlayer) : nullptr;
+		if (!Latency || !Input || !PC->PlayerCameraManager || !Character->GetLookAction() || !Character->GetSlowMoAction()) return false;
+
+		Controller = PC;
+		InputSubsystem = Input;
+		LatencyComponent = Latency;
+
+		bOriginalLateLook = Latency->bLateLookSampling;
+		Latency->SetLateLookSampling(bLateLook);
+		Latency->ResetHistograms();
+
+		MidFrameTick = MakeUnique<InputLatencyTest::FMidFrameTickFunction>();
+		MidFrameTick->Callback = [this]() { OnMidFrame(); };
+		MidFrameTick->TickGroup = TG_DuringPhysics;
+		MidFrameTick->bCanEverTick = true;
+		MidFrameTick->RegisterTickFunction(World->PersistentLevel);
+
+		PostTickHandle = FWorldDelegates::OnWorldPostActorTick.AddRaw(this, &FInputLatencyProbeCommand::OnWorldPostActorTick);
+		return true;
+	}
+
+	void Finish()
+	{
+		if (MidFrameTick && MidFrameTick->IsTickFunctionRegistered())
+		{
+			MidFrameTick->UnRegisterTickFunction();
+		}
+		MidFrameTick.Reset();
+
+		FWorldDelegates::OnWorldPostActorTick.Remove(PostTickHandle);
+		PostTickHandle.Reset();
+
+		if (UInputLatencyComponent* Latency = LatencyComponent.Get())
+		{
+			Latency->SetLateLookSampling(bOriginalLateLook);
+		}
+		LatencyComponent.Reset();
+	}
+
+	/** TG_DuringPhysics: 이번 프레임 입력 처리는 이미 끝남. 주입한 값은 다음 프레임 PlayerInput 에서 소비 */
+	void OnMidFrame()
+	{
+		UEnhancedInputLocalPlayerSubsystem* Input = InputSubsystem.Get();
+		AObstacleAssualtCharacter* Runner = Character.Get();
+		if (!Input || !Runner) return;
+
+		if (Phase == EPhase::Look)
+		{
+			// 이전 입력이 카메라에 반영된 뒤 한 프레임 쉬고 다음 입력
+			if (LookInjectFrame != 0 || GFrameCounter < NextLookFrame) return;
+
+			// 피치는 번갈아 주입해 제한에 걸리지 않게
+			BaselineYaw = Controller->PlayerCameraManager->GetCameraRotation().Yaw;
+			BaselineControl = Controller->GetControlRotation();
+			PitchSign = (LookDelays.Num() % 2) == 0 ? 1.0 : -1.0;
+			const UInputAction* Action = Runner->GetLookAction();
+			Input->InjectInputForAction(Action, FInputActionValue(Action->ValueType, FVector(LookStep, LookStep * PitchSign, 0.0)));
+			LookInjectFrame = GFrameCounter;
+		}
+		else if (Phase == EPhase::SlowMoHold)
+		{
+			// 누르고 있는 동안 매 프레임 주입 (Started 한 번, 멈추면 Completed)
+			if (SlowMoInjectFrame == 0)
+			{
+				SlowMoInjectFrame = GFrameCounter;
+			}
+			const UInputAction* Action = Runner->GetSlowMoAction();
+			Input->InjectInputForAction(Action, FInputActionValue(Action->ValueType, FVector(1.0, 0.0, 0.0)));
+		}
+	}
+
+	/** 모든 틱 그룹과 카메라 매니저 갱신이 끝난 뒤 */
+	void OnWorldPostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds)
+	{
+		if (InWorld != World.Get()) return;
+
+		AObstacleAssualtCharacter* Runner = Character.Get();
+		if (!Runner || !Controller.IsValid() || !Controller->PlayerCameraManager) return;
+
+		const double Now = FPlatformTime::Seconds();
+		switch (Phase)
+		{
+		case EPhase::Look:
+			if (LookInjectFrame != 0)
+			{
+				const int32 Frames = (int32)(GFrameCounter - LookInjectFrame);
+				const float Yaw = Controller->PlayerCameraManager->GetCameraRotation().Yaw;
+				const bool bMoved = FMath::Abs(FMath::FindDeltaAngleDegrees(BaselineYaw, Yaw)) > 0.01f;
+
+				// 상한을 넉넉히 넘기면 반영 안 된 것으로 기록하고 다음 입력으로
+				if (bMoved || Frames > InputLatencyTest::MaxFrames + 4)
+				{
+					if (bMoved)
+					{
+						const FRotator Control = Controller->GetControlRotation();
+						LookResponse->Yaw += FMath::FindDeltaAngleDegrees(BaselineControl.Yaw, Control.Yaw);
+						LookResponse->Pitch += FMath::FindDeltaAngleDegrees(BaselineControl.Pitch, Control.Pitch) * PitchSign;
+						++LookResponse->Count;
+					}
+					LookDelays.Add(bMoved ? Frames : MAX_int32);
+					LookInjectFrame = 0;
+					NextLookFrame = GFrameCounter + 2;
+				}
+			}
+			if (LookDelays.Num() >= InputLatencyTest::NumLooks)
+			{
+				Phase = EPhase::SlowMoHold;
+				PhaseStartSeconds = Now;
+			}
+			break;
+
+		case EPhase::SlowMoHold:
+			if (SlowMoInjectFrame != 0)
+			{
+				const int32 Frames = (int32)(GFrameCounter - SlowMoInjectFrame);
+				if (SlowMoFrames < 0 && Runner->IsSlowMoActive())
+				{
+					SlowMoFrames = Frames;
+				}
+				if (DilationFrames < 0 && InputLatencyTest::GetRequestedDilation(InWorld) < 1.f)
+				{
+					DilationFrames = Frames;
+				}
+			}
+			if (Now - PhaseStartSeconds >= InputLatencyTest::SlowMoHoldSeconds)
+			{
+				CheckSlowMoPress();
+				Phase = EPhase::SlowMoRelease;
+				PhaseStartSeconds = Now;
+			}
+			break;
+
+		case EPhase::SlowMoRelease:
+			if (Now - PhaseStartSeconds >= InputLatencyTest::SlowMoHoldSeconds)
+			{
+				if (Runner->IsSlowMoActive())
+				{
+					Test->AddError(TEXT("SlowMo still active after the injected press was released"));
+				}
+
+				++SlowMoPresses;
+				SlowMoInjectFrame = 0;
+				SlowMoFrames = -1;
+				DilationFrames = -1;
+				Phase = SlowMoPresses < InputLatencyTest::NumSlowMoPresses ? EPhase::SlowMoHold : EPhase::Done;
+				PhaseStartSeconds = Now;
+			}
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	void CheckSlowMoPress()
+	{
+		if (SlowMoFrames < 0 || SlowMoFrames > InputLatencyTest::MaxFrames)
+		{
+			Test->AddError(FString::Printf(TEXT("SlowMo press %d: StartSlowMo after %d frame(s), bound %d"),
+				SlowMoPresses, SlowMoFrames, InputLatencyTest::MaxFrames));
+		}
+		if (DilationFrames < 0 || DilationFrames > InputLatencyTest::MaxDilationFrames)
+		{
+			Test->AddError(FString::Printf(TEXT("SlowMo press %d: requested dilation after %d frame(s), bound %d"),
+				SlowMoPresses, DilationFrames, InputLatencyTest::MaxDilationFrames));
+		}
+	}
+
+	void Report()
+	{
+		int32 WorstLook = 0;
+		for (int32 Frames : LookDelays)
+		{
+			WorstLook = FMath::Max(WorstLook, Frames);
+		}
+		if (WorstLook > InputLatencyTest::MaxFrames)
+		{
+			Test->AddError(FString::Printf(TEXT("Look (late look %d): camera updated after %s frame(s), bound %d"),
+				bLateLook, WorstLook == MAX_int32 ? TEXT("never") : *FString::FromInt(WorstLook), InputLatencyTest::MaxFrames));
+		}
+
+		// 컴포넌트 히스토그램도 같은 상한 안이어야 함 (주입한 입력이 실제로 DoLook/StartSlowMo 를 거쳤는지 포함)
+		if (const UInputLatencyComponent* Latency = LatencyComponent.Get())
+		{
+			const EInputLatencyAction Actions[] = { EInputLatencyAction::Look, EInputLatencyAction::SlowMo };
+			for (EInputLatencyAction Action : Actions)
+			{
+				const FInputLatencyHistogram& Applied = Latency->GetHistogram(Action, EInputLatencyStage::Applied);
+				const TCHAR* Name = Action == EInputLatencyAction::Look ? TEXT("Look") : TEXT("SlowMo");
+				Test->AddInfo(FString::Printf(TEXT("%s applied (late look %d): %s"), Name, bLateLook, *Applied.ToString()));
+
+				if (Applied.Count.load() == 0)
+				{
+					Test->AddError(FString::Printf(TEXT("%s: injected input never reached UInputLatencyComponent"), Name));
+				}
+				else if (Applied.MaxFrames.load() > InputLatencyTest::MaxFrames)
+				{
+					Test->AddError(FString::Printf(TEXT("%s: applied after %d frame(s), bound %d"), Name, Applied.MaxFrames.load(), InputLatencyTest::MaxFrames));
+				}
+			}
+		}
+	}
+
+	FAutomationTestBase* Test;
+	bool bLateLook;
+	bool bOriginalLateLook = false;
+	TSharedRef<InputLatencyTest::FLookResponse> LookResponse;
+
+	TWeakObjectPtr<UWorld> World;
+	TWeakObjectPtr<APlayerController> Controller;
+	TWeakObjectPtr<AObstacleAssualtCharacter> Character;
+	TWeakObjectPtr<UEnhancedInputLocalPlayerSubsystem> InputSubsystem;
+	TWeakObjectPtr<UInputLatencyComponent> LatencyComponent;
+
+	TUniquePtr<InputLatencyTest::FMidFrameTickFunction> MidFrameTick;
+	FDelegateHandle PostTickHandle;
+
+	EPhase Phase = EPhase::Setup;
+	double PhaseStartSeconds = 0.0;
+
+	/** 시야: 주입 프레임, 주입 전 카메라 요, 입력별 반영까지 프레임 */
+	static constexpr double LookStep = 2.0;
+	uint64 LookInjectFrame = 0;
+	uint64 NextLookFrame = 0;
+	float BaselineYaw = 0.f;
+	FRotator BaselineControl = FRotator::ZeroRotator;
+	double PitchSign = 1.0;
+	TArray<int32> LookDelays;
+
+	/** 슬로우: 첫 주입 프레임, StartSlowMo / 목표 딜레이션까지 프레임 (-1 = 아직) */
+	uint64 SlowMoInjectFrame = 0;
+	int32 SlowMoFrames = -1;
+	int32 DilationFrames = -1;
+	int32 SlowMoPresses = 0;
+};
+
+/** 늦은 시야 샘플링이 즉시 적용과 같은 감도/피치 부호로 회전하는지 (컨트롤러 입력 배율 포함) */
+class FCompareLookResponseCommand : public IAutomationLatentCommand
+{
+public:
+	FCompareLookResponseCommand(FAutomationTestBase* InTest, TSharedRef<InputLatencyTest::FLookResponse> InImmediate, TSharedRef<InputLatencyTest::FLookResponse> InLate)
+		: Test(InTest)
+		, Immediate(InImmediate)
+		, Late(InLate)
+	{
+	}
+
+	virtual bool Update() override
+	{
+		if (Immediate->Count == 0 || Late->Count == 0)
+		{
+			Test->AddError(TEXT("Look response: no measured looks to compare"));
+			return true;
+		}
+
+		Check(TEXT("yaw"), Immediate->MeanYaw(), Late->MeanYaw());
+		Check(TEXT("pitch"), Immediate->MeanPitch(), Late->MeanPitch());
+		return true;
+	}
+
+private:
+	void Check(const TCHAR* Axis, double ImmediateDegrees, double LateDegrees)
+	{
+		Test->AddInfo(FString::Printf(TEXT("Look %s per input: immediate %.4f deg, late look %.4f deg"), Axis, ImmediateDegrees, LateDegrees));
+
+		const bool bSameSign = (ImmediateDegrees >= 0.0) == (LateDegrees >= 0.0);
+		const bool bClose = FMath::Abs(LateDegrees - ImmediateDegrees) <= FMath::Abs(ImmediateDegrees) * InputLatencyTest::LookResponseTolerance + 1e-3;
+		if (!bSameSign || !bClose)
+		{
+			Test->AddError(FString::Printf(TEXT("Late look %s differs from immediate: %.4f vs %.4f deg per input"), Axis, LateDegrees, ImmediateDegrees));
+		}
+	}
+
+	FAutomationTestBase* Test;
+	TSharedRef<InputLatencyTest::FLookResponse> Immediate;
+	TSharedRef<InputLatencyTest::FLookResponse> Late;
+};
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInputLatencyFrameBoundTest, "ObstacleAssualt.InputLatency.FrameBound",
+	EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FInputLatencyFrameBoundTest::RunTest(const FString& Parameters)
+{
+	// 기본 게임 맵의 로컬 플레이어 캐릭터로 (즉시 적용 / 늦은 시야 샘플링 두 경로 모두)
+	const FString Map = UGameMapsSettings::GetGameDefaultMap();
+	if (!TestTrue(TEXT("Open default game map"), AutomationOpenMap(Map)))
+	{
+		return false;
+	}
+
+	const TSharedRef<InputLatencyTest::FLookResponse> ImmediateLook = MakeShared<InputLatencyTest::FLookResponse>();
+	const TSharedRef<InputLatencyTest::FLookResponse> LateLook = MakeShared<InputLatencyTest::FLookResponse>();
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForMapToLoadCommand());
+	ADD_LATENT_AUTOMATION_COMMAND(FInputLatencyProbeCommand(this, /*bLateLook=*/false, ImmediateLook));
+	ADD_LATENT_AUTOMATION_COMMAND(FInputLatencyProbeCommand(this, /*bLateLook=*/true, LateLook));
+	ADD_LATENT_AUTOMATION_COMMAND(FCompareLookResponseCommand(this, ImmediateLook, LateLook));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -2,6 +2,10 @@
 
 
 #include "MovingPlatform.h"
+#include "HitchRecorder.h"
+#include "CourseInitSchedulerSubsystem.h"
+#include "GCReportSubsystem.h"
+#include "GameplayMathBridge.h"
 
 // Sets default values
 AMovingPlatform::AMovingPlatform()
@@ -9,11 +13,17 @@ AMovingPlatform::AMovingPlatform()
  	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
 	PrimaryActorTick.bCanEverTick = true;
 
+	bCanBeInCluster = true;
+}
+
+bool AMovingPlatform::CanBeInCluster() const
+{
+	return UGCReportSubsystem::ShouldClusterCourseContent() && Super::CanBeInCluster();
 }
 
 int MyTestFunction(float MyFloatParam, int MyIntParam)
 {
-	UE_LOG(LogTemp, Display, TEXT("MyFloatParam is %f, and MyIntParam is %d"), MyFloatParam, MyIntParam);
+	UE_LOG(LogTemp, Verbose, TEXT("MyFloatParam is %f, and MyIntParam is %d"), MyFloatParam, MyIntParam);
 
 	return 40;
 }
@@ -23,10 +33,59 @@ void AMovingPlatform::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// 시작점은 배치 위치 그대로여야 하므로 바로 저장
+	StartLocation = GetActorLocation();
+	PhaseTimeSeconds = GetWorld()->GetTimeSeconds();
+
+	// 나머지는 스케줄러가 프레임 예산 안에서 (가까운 발판 먼저). 그 전까지는 제자리에서 대기
+	if (UCourseInitSchedulerSubsystem* Scheduler = UCourseInitSchedulerSubsystem::Get(this))
+	{
+		SetActorTickEnabled(false);
+		Scheduler->Schedule(this, [this]() { InitializePlatform(); });
+	}
+	else
+	{
+		InitializePlatform();
+	}
+}
+
+void AMovingPlatform::InitializePlatform()
+{
+	if (bPlatformInitialized) return;
+
 	int ReturnValue = MyTestFunction(3.5f, 10);
-	UE_LOG(LogTemp, Display, TEXT("ReturnValue is %d"), ReturnValue);
+	UE_LOG(LogTemp, Verbose, TEXT("ReturnValue is %d"), ReturnValue);
 
-	StartLocation = GetActorLocation();
+	HitchRecorder = UHitchRecorderSubsystem::Get(this);
+
+	// 처음부터 돌던 것처럼 대기한 시간만큼 진행한 위치/회전에서 시작
+	const double Now = GetWorld()->GetTimeSeconds();
+	if (Now > PhaseTimeSeconds)
+	{
+		FMovingPlatformPhase Phase;
+		ComputeCatchUpPhase(Now, Phase);
+		RestorePhase(Phase);
+	}
+
+	bPlatformInitialized = true;
+	SetActorTickEnabled(true);
+}
+
+void AMovingPlatform::ComputeCatchUpPhase(double Now, FMovingPlatformPhase& OutPhase) const
+{
+	const double Elapsed = FMath::Max(0.0, Now - PhaseTimeSeconds);
+
+	GameplayMath::FPingPongState State;
+	State.Location = ToGameplayMath(GetActorLocation());
+	State.StartLocation = ToGameplayMath(StartLocation);
+	State.Velocity = ToGameplayMath(PlatformVelocity);
+	State = GameplayMath::AdvancePingPong(State, MoveDistance, Elapsed);
+
+	OutPhase.Location = FVector3f(FromGameplayMath(State.Location));
+	OutPhase.StartLocation = FVector3f(FromGameplayMath(State.StartLocation));
+	OutPhase.PlatformVelocity = FVector3f(FromGameplayMath(State.Velocity));
+	// AddActorLocalRotation 을 Elapsed 동안 한 번에
+	OutPhase.Rotation = FQuat4f(GetActorQuat() * FQuat(RotationVelocity * Elapsed));
 }
 
 // Called every frame
@@ -34,6 +93,9 @@ void AMovingPlatform::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+	FHitchScope HitchScope(HitchRecorder, EHitchScope::PlatformTick);
+	if (HitchRecorder) HitchRecorder->NotePlatformUpdated();
+
 	MovePlatform(DeltaTime);
 
 	RotatePlatform(DeltaTime);
@@ -43,27 +105,23 @@ void AMovingPlatform::MovePlatform(float DeltaTime)
 {
 	DistanceMoved = GetDistanceMoved();
 
-	if (DistanceMoved >= MoveDistance) 
-	{
-		float OverShoot = DistanceMoved - MoveDistance;
-		FString PlatformName = GetName();
-		UE_LOG(LogTemp, Display, TEXT("%s Overshoot by %f"), *PlatformName, OverShoot);
+	// 왕복 계산은 엔진 독립 라이브러리 (GameplayMath/GameplayMath.h)
+	GameplayMath::FPingPongState State;
+	State.Location = ToGameplayMath(GetActorLocation());
+	State.StartLocation = ToGameplayMath(StartLocation);
+	State.Velocity = ToGameplayMath(PlatformVelocity);
 
-		FVector MoveDirection = PlatformVelocity.GetSafeNormal();
-		FVector NewStartLocation = StartLocation + MoveDirection * MoveDistance;
-		SetActorLocation(NewStartLocation);
-		StartLocation = NewStartLocation;
-
-		PlatformVelocity = -PlatformVelocity;
-	}
-	else 
+	double Overshoot = 0.0;
+	if (GameplayMath::StepPingPong(State, MoveDistance, DeltaTime, Overshoot))
 	{
-		FVector CurrentLocation = GetActorLocation();
+		// Verbose가 꺼져 있으면 인자(GetName 포함)는 평가되지 않음
+		UE_LOG(LogTemp, Verbose, TEXT("%s Overshoot by %f"), *GetName(), Overshoot);
 
-		CurrentLocation += PlatformVelocity * DeltaTime;
-
-		SetActorLocation(CurrentLocation);
+		StartLocation = FromGameplayMath(State.StartLocation);
+		PlatformVelocity = FromGameplayMath(State.Velocity);
 	}
+
+	SetActorLocation(FromGameplayMath(State.Location));
 }
 
 void AMovingPlatform::RotatePlatform(float DeltaTime)
@@ -72,6 +130,35 @@ void AMovingPlatform::RotatePlatform(float DeltaTime)
 	AddActorLocalRotation(RotationToAdd);
 }
 
+void AMovingPlatform::CapturePhase(FMovingPlatformPhase& OutPhase) const
+{
+	if (!bPlatformInitialized)
+	{
+		// 아직 대기 중이면 지금 시점 위상을 계산해서 저장 (액터는 건드리지 않음)
+		ComputeCatchUpPhase(GetWorld()->GetTimeSeconds(), OutPhase);
+		return;
+	}
+
+	OutPhase.Location = FVector3f(GetActorLocation());
+	OutPhase.StartLocation = FVector3f(StartLocation);
+	OutPhase.PlatformVelocity = FVector3f(PlatformVelocity);
+	OutPhase.Rotation = FQuat4f(GetActorQuat());
+}
+
+void AMovingPlatform::RestorePhase(const FMovingPlatformPhase& Phase)
+{
+	StartLocation = FVector(Phase.StartLocation);
+	PlatformVelocity = FVector(Phase.PlatformVelocity);
+	SetActorLocationAndRotation(FVector(Phase.Location), FQuat(Phase.Rotation), false, nullptr, ETeleportType::TeleportPhysics);
+	DistanceMoved = GetDistanceMoved();
+
+	// 초기화 대기 중이면 여기서부터 다시 따라잡음
+	if (UWorld* World = GetWorld())
+	{
+		PhaseTimeSeconds = World->GetTimeSeconds();
+	}
+}
+
 float AMovingPlatform::GetDistanceMoved()
 {
 	return FVector::Dist(StartLocation, GetActorLocation());
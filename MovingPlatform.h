@@ -6,6 +6,17 @@
 #include "GameFramework/Actor.h"
 #include "MovingPlatform.generated.h"
 
+class UHitchRecorderSubsystem;
+
+/** 체크포인트용 발판 위상 (UCourseSnapshotSubsystem 에서 배열로 보관) */
+struct FMovingPlatformPhase
+{
+	FVector3f Location;
+	FVector3f StartLocation;
+	FVector3f PlatformVelocity;
+	FQuat4f Rotation;
+};
+
 UCLASS()
 class OBSTACLEASSUALT_API AMovingPlatform : public AActor
 {
@@ -23,12 +34,27 @@ public:
 	// Called every frame
 	virtual void Tick(float DeltaTime) override;
 
+	/**
+	 *  레벨과 수명이 같으므로 레벨 GC 클러스터에 넣는다 (UGCReportSubsystem::ShouldClusterCourseContent).
+	 *  클러스터가 만들어진 뒤에는 발판이나 컴포넌트에 새 UObject 참조를 붙이면 안 된다 (카메라 페이드는 커스텀 프리미티브 데이터)
+	 */
+	virtual bool CanBeInCluster() const override;
+
 	void MovePlatform(float DeltaTime);
 
 	void RotatePlatform(float DeltaTime);
 
 	float GetDistanceMoved();
 
+	/** 현재 위상 저장 / 복원 (액터 재생성 없이 제자리에서) */
+	void CapturePhase(FMovingPlatformPhase& OutPhase) const;
+	void RestorePhase(const FMovingPlatformPhase& Phase);
+
+	/** UCourseInitSchedulerSubsystem 이 예산 안에서 부르는 나머지 초기화. 대기한 시간만큼 위상을 맞추고 틱 시작 */
+	void InitializePlatform();
+
+	bool IsPlatformInitialized() const { return bPlatformInitialized; }
+
 	UPROPERTY(EditAnywhere)
 	FVector PlatformVelocity = FVector(0.0f, 0.0f, 0.0f);
 
@@ -42,4 +68,17 @@ public:
 	FRotator RotationVelocity;
 
 	FVector StartLocation;
+
+private:
+	/** PhaseTimeSeconds 부터 Now 까지 흐른 시간만큼 진행한 위상 (초기화 전 발판용) */
+	void ComputeCatchUpPhase(double Now, FMovingPlatformPhase& OutPhase) const;
+
+	/** 클러스터 멤버가 런타임에 잡는 참조는 GC가 따라가지 않으므로 월드와 수명이 같은 오브젝트만 */
+	UPROPERTY(Transient)
+	TObjectPtr<UHitchRecorderSubsystem> HitchRecorder;
+
+	/** 현재 위치/회전이 유효한 월드 시각 (초기화 대기 중에만 의미 있음) */
+	double PhaseTimeSeconds = 0.0;
+
+	bool bPlatformInitialized = false;
 };
@@ -3,6 +3,8 @@
 #include "ObstacleAssualtCharacter.h"
 #include "Engine/LocalPlayer.h"
 #include "Camera/CameraComponent.h"
+#include "CameraOcclusionComponent.h"
+#include "InputLatencyComponent.h"
 #include "Components/PrimitiveComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -16,13 +18,29 @@
 #include "Kismet/GameplayStatics.h"
 #include "Sound/SoundBase.h"
 #include "Components/AudioComponent.h"
+#include "StreamingBGM.h"
+#include "GameFramework/WorldSettings.h"
 #include "ObstacleAssualtPlayerController.h"
 #include "Blueprint/UserWidget.h"
 #include "PlaytimeWidget.h"
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Animation/AnimInstance.h"
+#include "Components/SkeletalMeshComponent.h"
 #include "DrawDebugHelpers.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "HitchRecorder.h"
+#include "CourseInitSchedulerSubsystem.h"
+#include "TelemetrySubsystem.h"
+#include "GameplayMathBridge.h"
+#include "HazardSubsystem.h"
+#include "TimerManager.h"
+#include "ObstacleAssualtGameState.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarTimeDilationRequestInterval(
+	TEXT("oa.TimeDilation.RequestInterval"),
+	0.1f,
+	TEXT("슬로우 요청 RPC 최소 간격 (실시간 초). 그 사이 눌렀다 뗀 입력은 마지막 상태 하나로 합쳐 보냄"));
 
 AObstacleAssualtCharacter::AObstacleAssualtCharacter()
 {
@@ -58,6 +76,12 @@ AObstacleAssualtCharacter::AObstacleAssualtCharacter()
 	FollowCamera->SetupAttachment(CameraBoom, USpringArmComponent::SocketName);
 	FollowCamera->bUsePawnControlRotation = false;
 
+	// 카메라 차폐 검사를 비동기 스윕으로 처리 (붐의 동기 충돌 검사는 BeginPlay에서 꺼짐)
+	CameraOcclusion = CreateDefaultSubobject<UCameraOcclusionComponent>(TEXT("CameraOcclusion"));
+
+	// 입력 지연 계측 (DoMove/DoLook/DoJumpStart/StartSlowMo)
+	InputLatency = CreateDefaultSubobject<UInputLatencyComponent>(TEXT("InputLatency"));
+
 	// Note: The skeletal mesh and anim blueprint references on the Mesh component (inherited from Character) 
 	// are set in the derived blueprint asset named ThirdPersonCharacter (to avoid direct content references in C++)
 }
@@ -78,9 +102,9 @@ void AObstacleAssualtCharacter::SetupPlayerInputComponent(UInputComponent* Playe
 	// Set up action bindings
 	if (UEnhancedInputComponent* EnhancedInputComponent = Cast<UEnhancedInputComponent>(PlayerInputComponent)) {
 		
-		// Jumping
-		EnhancedInputComponent->BindAction(JumpAction, ETriggerEvent::Started, this, &ACharacter::Jump);
-		EnhancedInputComponent->BindAction(JumpAction, ETriggerEvent::Completed, this, &ACharacter::StopJumping);
+		// Jumping (DoJumpStart/DoJumpEnd 경유 → 입력 지연 계측)
+		EnhancedInputComponent->BindAction(JumpAction, ETriggerEvent::Started, this, &AObstacleAssualtCharacter::DoJumpStart);
+		EnhancedInputComponent->BindAction(JumpAction, ETriggerEvent::Completed, this, &AObstacleAssualtCharacter::DoJumpEnd);
 
 		// Moving
 		EnhancedInputComponent->BindAction(MoveAction, ETriggerEvent::Triggered, this, &AObstacleAssualtCharacter::Move);
@@ -100,35 +124,111 @@ void AObstacleAssualtCharacter::BeginPlay()
 	Super::BeginPlay();
 
 	// 로컬 플레이어에 IMC 적용
+	ApplyInputMappingContext();
+
+	// BGM / 포스트프로세스 / 위젯 (풀이 미리 만드는 인스턴스는 음악을 재생하지 않음)
+	// 원격 러너는 급하지 않으므로 스케줄러에 맡겨 가까운 러너부터 프레임 예산 안에서
+	UCourseInitSchedulerSubsystem* Scheduler = HasPresentation() && !IsLocallyControlled() ? UCourseInitSchedulerSubsystem::Get(this) : nullptr;
+	if (Scheduler)
+	{
+		// 플레이타임 시작은 스폰 시각 기준
+		StartGameSeconds = GetWorld()->GetTimeSeconds();
+		StartRealSeconds = UGameplayStatics::GetRealTimeSeconds(GetWorld());
+		bPresentationPending = true;
+
+		Scheduler->Schedule(this, [this]()
+		{
+			// 그 사이 ResetForReuse 가 먼저 초기화했으면 건너뜀
+			if (!bPresentationPending) return;
+			bPresentationPending = false;
+
+			const float SpawnGameSeconds = StartGameSeconds;
+			const float SpawnRealSeconds = StartRealSeconds;
+			InitPresentation(/*bStartPlayback=*/!bSpawnedForPool);
+			StartGameSeconds = SpawnGameSeconds;
+			StartRealSeconds = SpawnRealSeconds;
+		});
+	}
+	else
+	{
+		InitPresentation(/*bStartPlayback=*/!bSpawnedForPool);
+	}
+
+	if (!HasPresentation())
+	{
+		StripPresentationForServer();
+	}
+
+	if (UCapsuleComponent* Cap = GetCapsuleComponent())
+	{
+		Cap->SetNotifyRigidBodyCollision(true);
+		Cap->OnComponentHit.AddDynamic(this, &AObstacleAssualtCharacter::OnCapsuleHit);
+	}
+
+	HitchRecorder = UHitchRecorderSubsystem::Get(this);
+
+	// 위치 샘플은 풀 대기 중(숨김)이면 건너뜀
+	Telemetry = UTelemetrySubsystem::Get(this);
+	if (Telemetry) Telemetry->RegisterRunner(this);
+
+	if (bSpawnedForPool)
+	{
+		// 풀에서 꺼낼 때 ResetForReuse로 다시 활성화
+		DeactivateForPool();
+		return;
+	}
+
+	// 위험 요소 접촉은 서브시스템이 일괄 판정
+	if (UHazardSubsystem* Hazards = GetWorld()->GetSubsystem<UHazardSubsystem>())
+	{
+		Hazards->RegisterRunner(this);
+	}
+
+	// 시작 지점을 첫 체크포인트로 (발판 BeginPlay가 끝난 다음 틱에 저장)
+	GetWorldTimerManager().SetTimerForNextTick(this, &AObstacleAssualtCharacter::SaveCheckpoint);
+}
+
+void AObstacleAssualtCharacter::NotifyControllerChanged()
+{
+	Super::NotifyControllerChanged();
+
+	// 카메라 차폐는 로컬 조종 폰에서만 (BeginPlay 때는 클라이언트 컨트롤러가 아직 없을 수 있음)
+	if (CameraOcclusion) CameraOcclusion->RefreshLocalControl();
+
+	// 스트리밍 BGM 도 로컬 조종 여부를 따름 (풀 대기 폰은 ResetForReuse 에서 다시 준비)
+	if (HasActorBegunPlay() && HasPresentation() && !bPresentationPending && !IsHidden())
+	{
+		InitBGM(/*bRestart=*/false);
+	}
+}
+
+void AObstacleAssualtCharacter::ApplyInputMappingContext()
+{
 	if (APlayerController* PC = Cast<APlayerController>(GetController()))
 	{
 		if (ULocalPlayer* LP = PC->GetLocalPlayer())
 		{
 			if (UEnhancedInputLocalPlayerSubsystem* Subsys = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(LP))
 			{
-				if (PlayerIMC)
+				if (PlayerIMC && !Subsys->HasMappingContext(PlayerIMC))
 				{
 					Subsys->AddMappingContext(PlayerIMC, /*Priority=*/0);
 				}
 			}
 		}
 	}
+}
 
-	if (BGM)
-	{
-		// SpawnSound2D는 월드 어디서나 들리는 2D 음악을 생성 + 재생
-		// 반환된 AudioComponent를 잡아서 피치/볼륨 제어에 사용
-		BGMComponent = UGameplayStatics::SpawnSound2D(this, BGM, /*VolumeMultiplier=*/1.0f, /*PitchMultiplier=*/NormalPitch, /*StartTime=*/0.0f, /*ConcurrencySettings=*/nullptr, /*bAutoDestroy=*/false);
-		if (BGMComponent)
-		{
-			BGMComponent->bIsUISound = false;
-			BGMComponent->SetUISound(false);
-			if (!BGMComponent->IsPlaying())
-			{
-				BGMComponent->Play();
-			}
-		}
-	}
+void AObstacleAssualtCharacter::InitPresentation(bool bStartPlayback)
+{
+	// 시작 시각 저장 (체크포인트 타이머에도 쓰이므로 서버에서도 필요)
+	StartGameSeconds = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.f;
+	StartRealSeconds = UGameplayStatics::GetRealTimeSeconds(GetWorld());
+
+	// 데디케이티드 서버는 음악/포스트프로세스/위젯/카메라 탐색 모두 생략
+	if (!HasPresentation()) return;
+
+	InitBGM(/*bRestart=*/bStartPlayback);
 
 	if (!FollowCamera)
 	{
@@ -151,43 +251,265 @@ void AObstacleAssualtCharacter::BeginPlay()
 	}
 
 	// 포스트프로세스 MID 만들어 FollowCamera에 붙이기
-	if (FollowCamera && DesaturatePPMaterial)
+	if (FollowCamera && DesaturatePPMaterial && !DesaturatePPMID)
 	{
 		DesaturatePPMID = UMaterialInstanceDynamic::Create(DesaturatePPMaterial, this);
 		FollowCamera->PostProcessSettings.AddBlendable(DesaturatePPMID, 1.0f);
+	}
+	if (DesaturatePPMID)
+	{
 		DesaturatePPMID->SetScalarParameterValue(TEXT("DesatAmount"), 0.0f); // 평상시 컬러
 	}
-
-	// 시작 시각 저장
-	StartGameSeconds = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.f;
-	StartRealSeconds = UGameplayStatics::GetRealTimeSeconds(GetWorld());
+	TargetDesat = 0.f;
 
 	// 위젯 생성 & 화면 추가
 	if (IsLocallyControlled() && PlaytimeWidgetClass)
 	{
-		if (APlayerController* PC = Cast<APlayerController>(GetController()))
+		APlayerController* PC = Cast<APlayerController>(GetController());
+		if (!PlaytimeWidget)
 		{
-			PlaytimeWidget = CreateWidget<UPlaytimeWidget>(PC, PlaytimeWidgetClass);
+			if (PC)
+			{
+				PlaytimeWidget = CreateWidget<UPlaytimeWidget>(PC, PlaytimeWidgetClass);
+			}
+			else
+			{
+				PlaytimeWidget = CreateWidget<UPlaytimeWidget>(GetWorld(), PlaytimeWidgetClass);
+			}
 		}
-		else
+		else if (PC && PlaytimeWidget->GetOwningPlayer() != PC)
 		{
-			PlaytimeWidget = CreateWidget<UPlaytimeWidget>(GetWorld(), PlaytimeWidgetClass);
+			// 다른 컨트롤러가 빙의한 재사용 폰
+			PlaytimeWidget->SetOwningPlayer(PC);
 		}
 
 		if (PlaytimeWidget)
 		{
-			PlaytimeWidget->AddToViewport(999);
+			if (!PlaytimeWidget->IsInViewport())
+			{
+				PlaytimeWidget->AddToViewport(999);
+			}
 			PlaytimeWidget->SetTimeSeconds(0.f);
 		}
 	}
+}
 
-	if (UCapsuleComponent* Cap = GetCapsuleComponent())
+bool AObstacleAssualtCharacter::HasPresentation() const
+{
+#if UE_SERVER
+	// 서버 전용 빌드에서는 표시 경로 전체가 컴파일 단계에서 제거됨
+	return false;
+#else
+	return !IsNetMode(NM_DedicatedServer);
+#endif
+}
+
+void AObstacleAssualtCharacter::InitBGM(bool bRestart)
+{
+	// 스트리밍 BGM: 상주 메모리는 청크 캐시 크기뿐이지만 러너마다 읽기 스레드와 캐시를 두면
+	// 원격 러너/풀 대기 폰 수만큼 늘어나므로 로컬 조종 러너만 열고, 나머지는 읽기 스레드를 멈춤
+	const bool bUseStream = !BGMStreamFile.IsEmpty();
+	const bool bLocal = IsLocallyControlled();
+	if (bUseStream && bLocal)
 	{
-		Cap->SetNotifyRigidBodyCollision(true);
-		Cap->OnComponentHit.AddDynamic(this, &AObstacleAssualtCharacter::OnCapsuleHit);
+		if (!StreamingBGM)
+		{
+			StreamingBGM = NewObject<UStreamingBGMSound>(this);
+			if (!StreamingBGM->OpenStream(BGMStreamFile))
+			{
+				StreamingBGM = nullptr;
+			}
+		}
+		else
+		{
+			StreamingBGM->ResumeStream();
+		}
+	}
+	else if (StreamingBGM)
+	{
+		StreamingBGM->SuspendStream();
+	}
+
+	// 파일이 없거나 형식이 안 맞으면 BGM 에셋으로. 원격 러너는 스트리밍 설정이면 음악 없음
+	USoundBase* Music = nullptr;
+	if (!bUseStream || bLocal)
+	{
+		Music = StreamingBGM ? (USoundBase*)StreamingBGM : BGM.Get();
+	}
+
+	// 이미 만들어 둔 오브젝트는 재생성하지 않고 재사용 (풀 재사용 시 할당/GC 없음)
+	bool bMusicChanged = false;
+	if (Music && !BGMComponent)
+	{
+		// CreateSound2D는 월드 어디서나 들리는 2D 음악 컴포넌트를 만들기만 함 (재생은 아래에서)
+		// 반환된 AudioComponent를 잡아서 피치/볼륨 제어에 사용 (스트리밍이면 속도는 스트림이 직접 처리)
+		BGMComponent = UGameplayStatics::CreateSound2D(this, Music, /*VolumeMultiplier=*/1.0f, /*PitchMultiplier=*/StreamingBGM ? 1.0f : NormalPitch, /*StartTime=*/0.0f, /*ConcurrencySettings=*/nullptr, /*bPersistAcrossLevelTransition=*/false, /*bAutoDestroy=*/false);
+		if (BGMComponent)
+		{
+			BGMComponent->bIsUISound = false;
+			BGMComponent->SetUISound(false);
+		}
+		bMusicChanged = true;
+	}
+	else if (BGMComponent && BGMComponent->Sound != Music)
+	{
+		// 다른 컨트롤러가 빙의한 재사용 폰 (로컬 ↔ 원격)
+		BGMComponent->Stop();
+		BGMComponent->SetSound(Music);
+		BGMComponent->SetPitchMultiplier(Music == StreamingBGM ? 1.0f : NormalPitch);
+		bMusicChanged = true;
+	}
+
+	if (BGMComponent && Music && (bRestart || bMusicChanged))
+	{
+		if (Music == StreamingBGM)
+		{
+			StreamingBGM->Rewind();
+		}
+		else
+		{
+			BGMComponent->SetPitchMultiplier(NormalPitch);
+		}
+		BGMComponent->Play(0.f);
+	}
+	AppliedBGMRate = -1.f;
+	UpdateBGMRate();
+}
+
+void AObstacleAssualtCharacter::UpdateBGMRate()
+{
+	if (!BGMComponent || !BGMComponent->Sound) return;
+
+	const AWorldSettings* Settings = GetWorldSettings();
+	const float Dilation = Settings ? Settings->GetEffectiveTimeDilation() : 1.f;
+	const float Rate = FMath::Max(0.01f, NormalPitch * Dilation);
+	if (FMath::IsNearlyEqual(Rate, AppliedBGMRate, 1e-3f)) return;
+
+	AppliedBGMRate = Rate;
+	if (StreamingBGM && BGMComponent->Sound == StreamingBGM)
+	{
+		// 원자 변수 하나만 바꾸고, 부드러운 전환은 오디오 스레드가 처리
+		StreamingBGM->SetTargetRate(Rate);
+	}
+	else
+	{
+		BGMComponent->SetPitchMultiplier(Rate);
 	}
 }
 
+void AObstacleAssualtCharacter::StripPresentationForServer()
+{
+	// 카메라 붐: 서버에는 뷰가 없으므로 충돌 스윕/틱 불필요
+	if (CameraBoom)
+	{
+		CameraBoom->bDoCollisionTest = false;
+		CameraBoom->SetComponentTickEnabled(false);
+	}
+
+	// 메시 포즈는 보여줄 곳이 없음. 등반 몽타주(노티파이)만 유지
+	if (USkeletalMeshComponent* MeshComp = GetMesh())
+	{
+		MeshComp->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
+	}
+
+	// 액터 Tick은 디새츄레이션 보간과 위젯 갱신뿐이므로 등록 해제
+	SetActorTickEnabled(false);
+}
+
+void AObstacleAssualtCharacter::ResetForReuse()
+{
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	SetActorTickEnabled(HasPresentation());
+
+	if (UCharacterMovementComponent* Move = GetCharacterMovement())
+	{
+		Move->StopMovementImmediately();
+		Move->GravityScale = 1.f;
+		Move->bUseControllerDesiredRotation = false;
+		Move->bOrientRotationToMovement = true;
+		Move->SetDefaultMovementMode();
+	}
+
+	// 등반/슬로우 상태 초기화
+	bIsHanging = false;
+	bClimbInProgress = false;
+	CurrentLedge = FLedgeInfo{};
+	LastAutoClimbTime = -1000.f;
+	if (bIsSlowMo) StopSlowMo();
+
+	ApplyInputMappingContext();
+	bPresentationPending = false;
+	InitPresentation(/*bStartPlayback=*/true);
+
+	if (UHazardSubsystem* Hazards = GetWorld()->GetSubsystem<UHazardSubsystem>())
+	{
+		Hazards->RegisterRunner(this);
+	}
+
+	bHasCheckpoint = false;
+	GetWorldTimerManager().SetTimerForNextTick(this, &AObstacleAssualtCharacter::SaveCheckpoint);
+}
+
+void AObstacleAssualtCharacter::DeactivateForPool()
+{
+	// 아직 빙의 상태일 때 호출되어야 서버 RPC(슬로우 해제)가 나감 (간격 제한 없이 바로)
+	if (bIsSlowMo) StopSlowMo();
+	FlushSlowMoRequest(/*bForce=*/true);
+
+	GetWorldTimerManager().ClearAllTimersForObject(this);
+
+	if (BGMComponent)
+	{
+		BGMComponent->Stop();
+	}
+	if (StreamingBGM)
+	{
+		// 풀 대기 중엔 디스크 읽기 스레드도 멈춤 (ResetForReuse 의 InitPresentation 에서 재시작)
+		StreamingBGM->SuspendStream();
+	}
+	if (PlaytimeWidget)
+	{
+		PlaytimeWidget->RemoveFromParent();
+	}
+
+	if (UCharacterMovementComponent* Move = GetCharacterMovement())
+	{
+		Move->StopMovementImmediately();
+		Move->DisableMovement();
+	}
+
+	if (UHazardSubsystem* Hazards = GetWorld()->GetSubsystem<UHazardSubsystem>())
+	{
+		Hazards->UnregisterRunner(this);
+	}
+
+	bHasCheckpoint = false;
+
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	SetActorTickEnabled(false);
+}
+
+void AObstacleAssualtCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UHazardSubsystem* Hazards = GetWorld() ? GetWorld()->GetSubsystem<UHazardSubsystem>() : nullptr)
+	{
+		Hazards->UnregisterRunner(this);
+	}
+	if (Telemetry) Telemetry->UnregisterRunner(this);
+
+	if (HasAuthority())
+	{
+		if (AObstacleAssualtGameState* GameState = GetWorld() ? GetWorld()->GetGameState<AObstacleAssualtGameState>() : nullptr)
+		{
+			GameState->ClearSlowMoRequest(this);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void AObstacleAssualtCharacter::Move(const FInputActionValue& Value)
 {
 	// input is a Vector2D
@@ -208,6 +530,8 @@ void AObstacleAssualtCharacter::Look(const FInputActionValue& Value)
 
 void AObstacleAssualtCharacter::DoMove(float Right, float Forward)
 {
+	if (InputLatency) InputLatency->MarkInput(EInputLatencyAction::Move);
+
 	if (GetController() != nullptr)
 	{
 		// find out which way is forward
@@ -228,6 +552,11 @@ void AObstacleAssualtCharacter::DoMove(float Right, float Forward)
 
 void AObstacleAssualtCharacter::DoLook(float Yaw, float Pitch)
 {
+	if (InputLatency) InputLatency->MarkInput(EInputLatencyAction::Look);
+
+	// 늦은 샘플링 모드면 이동이 끝난 뒤 카메라 갱신 전(PostPhysics)에 한꺼번에 적용
+	if (InputLatency && InputLatency->BufferLook(Yaw, Pitch)) return;
+
 	if (GetController() != nullptr)
 	{
 		// add yaw and pitch input to controller
@@ -238,6 +567,8 @@ void AObstacleAssualtCharacter::DoLook(float Yaw, float Pitch)
 
 void AObstacleAssualtCharacter::DoJumpStart()
 {
+	if (InputLatency) InputLatency->MarkInput(EInputLatencyAction::Jump);
+
 	// signal the character to jump
 	Jump();
 }
@@ -252,9 +583,22 @@ void AObstacleAssualtCharacter::Tick(float DeltaSeconds)
 {
 	Super::Tick(DeltaSeconds);
 
+	FHitchScope HitchScope(HitchRecorder, EHitchScope::CharacterTick);
+	if (HitchRecorder) HitchRecorder->NoteSlowMo(bIsSlowMo);
+
+	// 간격 제한에 걸려 못 보낸 슬로우 상태 재시도
+	if (bIsSlowMo != bSlowMoRequestSent) FlushSlowMoRequest();
+
+	UpdateBGMRate();
+
 	// DesatAmount를 부드럽게 보간 (0 ↔ 1)
 	if (DesaturatePPMID)
 	{
+		// 목표는 로컬 입력이 아니라 서버가 정한(클라이언트가 예측한) 실제 딜레이션에 비례
+		const AWorldSettings* Settings = GetWorldSettings();
+		const float Dilation = Settings ? Settings->GetEffectiveTimeDilation() : 1.f;
+		TargetDesat = SlowMoDesat * FMath::Clamp((1.f - Dilation) / FMath::Max(0.01f, 1.f - GlobalTimeDilation), 0.f, 1.f);
+
 		float Current = 0.f;
 		DesaturatePPMID->GetScalarParameterValue(TEXT("DesatAmount"), Current);
 
@@ -288,20 +632,153 @@ void AObstacleAssualtCharacter::Tick(float DeltaSeconds)
 	}
 }
 
+void AObstacleAssualtCharacter::ApplyHazardKnockback(const FVector& LaunchVelocity)
+{
+	if (bIsHanging || bClimbInProgress) return;
+
+	// 이동 컴포넌트를 통해 적용 (Falling 전환 + 네트워크 예측 유지)
+	LaunchCharacter(LaunchVelocity, /*bXYOverride=*/true, /*bZOverride=*/true);
+}
+
+void AObstacleAssualtCharacter::SaveCheckpoint()
+{
+	if (bIsHanging || bClimbInProgress)
+	{
+		UE_LOG(LogObstacleAssualt, Verbose, TEXT("%s: checkpoint skipped while hanging/climbing"), *GetName());
+		return;
+	}
+
+	CaptureRunnerState(Checkpoint);
+	bHasCheckpoint = true;
+
+	// 발판은 월드 공용이므로 혼자 플레이할 때만 함께 저장/복원
+	if (GetNetMode() == NM_Standalone)
+	{
+		if (const UCourseSnapshotSubsystem* Snapshots = GetWorld()->GetSubsystem<UCourseSnapshotSubsystem>())
+		{
+			Snapshots->CaptureCourse(Checkpoint.Course);
+		}
+	}
+}
+
+void AObstacleAssualtCharacter::RespawnAtCheckpoint()
+{
+	if (!bHasCheckpoint) return;
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	RestoreRunnerState(Checkpoint);
+
+	if (GetNetMode() == NM_Standalone)
+	{
+		if (const UCourseSnapshotSubsystem* Snapshots = GetWorld()->GetSubsystem<UCourseSnapshotSubsystem>())
+		{
+			// 이 러너의 체크포인트 시점으로 (마지막으로 저장한 다른 러너의 시점이 아니라)
+			Snapshots->RestoreCourse(Checkpoint.Course);
+		}
+	}
+
+	UE_LOG(LogObstacleAssualt, Verbose, TEXT("%s respawned at checkpoint in %.3f ms"), *GetName(), FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles));
+}
+
+void AObstacleAssualtCharacter::CaptureRunnerState(FRunnerSnapshot& OutSnapshot) const
+{
+	OutSnapshot.Transform = GetActorTransform();
+	OutSnapshot.ControlRotation = GetController() ? GetController()->GetControlRotation() : GetActorRotation();
+
+	if (const UCharacterMovementComponent* Move = GetCharacterMovement())
+	{
+		OutSnapshot.Velocity = Move->Velocity;
+		OutSnapshot.MovementMode = Move->MovementMode;
+		OutSnapshot.CustomMovementMode = Move->CustomMovementMode;
+		OutSnapshot.GravityScale = Move->GravityScale;
+	}
+
+	OutSnapshot.bIsSlowMo = bIsSlowMo;
+
+	const UWorld* World = GetWorld();
+	OutSnapshot.ElapsedGameSeconds = (World ? World->GetTimeSeconds() : 0.f) - StartGameSeconds;
+	OutSnapshot.ElapsedRealSeconds = UGameplayStatics::GetRealTimeSeconds(World) - StartRealSeconds;
+}
+
+void AObstacleAssualtCharacter::RestoreRunnerState(const FRunnerSnapshot& Snapshot)
+{
+	// 진행 중인 등반 몽타주는 종료 콜백 없이 끊음 (FinishClimbUpSequence가 복원값을 덮지 않도록)
+	// 그 대신 아래에서 매달림/등반 상태를 직접 정리한다
+	if (bClimbInProgress && ClimbUpMontage)
+	{
+		if (UAnimInstance* Anim = GetMesh() ? GetMesh()->GetAnimInstance() : nullptr)
+		{
+			Anim->Montage_SetEndDelegate(FOnMontageEnded(), ClimbUpMontage);
+			Anim->Montage_Stop(0.f, ClimbUpMontage);
+		}
+	}
+
+	SetActorLocationAndRotation(Snapshot.Transform.GetLocation(), Snapshot.Transform.GetRotation(), false, nullptr, ETeleportType::TeleportPhysics);
+	if (AController* C = GetController())
+	{
+		C->SetControlRotation(Snapshot.ControlRotation);
+	}
+
+	if (UCharacterMovementComponent* Move = GetCharacterMovement())
+	{
+		Move->StopMovementImmediately();
+		Move->GravityScale = Snapshot.GravityScale;
+		Move->bUseControllerDesiredRotation = true;
+		Move->bOrientRotationToMovement = true;
+
+		// 매달림/등반의 Flying 은 끝낼 콜백 없이 복원되면 갇히므로 기본 이동 모드로 (바닥이 없으면 곧 Falling)
+		if (Snapshot.MovementMode == MOVE_Flying || Snapshot.MovementMode == MOVE_None)
+		{
+			Move->SetDefaultMovementMode();
+		}
+		else
+		{
+			Move->SetMovementMode((EMovementMode)Snapshot.MovementMode, Snapshot.CustomMovementMode);
+		}
+		Move->Velocity = Snapshot.Velocity;
+	}
+
+	bIsHanging = false;
+	bClimbInProgress = false;
+	CurrentLedge = FLedgeInfo();
+
+	if (Snapshot.bIsSlowMo != bIsSlowMo)
+	{
+		Snapshot.bIsSlowMo ? StartSlowMo() : StopSlowMo();
+	}
+
+	// 타이머는 경과 시간이 유지되도록 시작 시각을 다시 계산
+	const UWorld* World = GetWorld();
+	StartGameSeconds = (World ? World->GetTimeSeconds() : 0.f) - Snapshot.ElapsedGameSeconds;
+	StartRealSeconds = UGameplayStatics::GetRealTimeSeconds(World) - Snapshot.ElapsedRealSeconds;
+}
+
+void AObstacleAssualtCharacter::FellOutOfWorld(const UDamageType& DmgType)
+{
+	if (Telemetry) Telemetry->Record(ETelemetryEvent::Fall, this, GetVelocity().Z);
+
+	if (bHasCheckpoint)
+	{
+		RespawnAtCheckpoint();
+		return;
+	}
+
+	Super::FellOutOfWorld(DmgType);
+}
+
 void AObstacleAssualtCharacter::StartSlowMo()
 {
 	if (bIsSlowMo) return;
 	bIsSlowMo = true;
 
-	// 전역 타임 딜레이션은 서버 권한에서 적용
-	ServerSetSlowMo(/*bEnable=*/true, GlobalTimeDilation);
+	if (InputLatency) InputLatency->MarkInput(EInputLatencyAction::SlowMo);
+	if (Telemetry) Telemetry->Record(ETelemetryEvent::SlowMoOn, this, GlobalTimeDilation);
 
-	TargetDesat = 0.4f;
+	// 전역 타임 딜레이션은 서버 권한에서 적용. BGM/디새츄레이션은 적용된 딜레이션을 Tick 에서 따라감
+	++SlowMoToggles;
+	FlushSlowMoRequest();
 
-	if (BGMComponent)
-	{
-		BGMComponent->SetPitchMultiplier(FMath::Max(0.01f, GlobalTimeDilation));
-	}
 	CustomTimeDilation = 1.f;
 	if (AController* C = GetController())
 		if (AActor* AsActor = Cast<AActor>(C))
@@ -313,15 +790,10 @@ void AObstacleAssualtCharacter::StopSlowMo()
 	if (!bIsSlowMo) return;
 	bIsSlowMo = false;
 
-	ServerSetSlowMo(/*bEnable=*/false, /*ignored*/1.f);
+	if (Telemetry) Telemetry->Record(ETelemetryEvent::SlowMoOff, this, 1.f);
 
-	TargetDesat = 0.0f;
-
-	// 음악 피치 복구
-	if (BGMComponent)
-	{
-		BGMComponent->SetPitchMultiplier(NormalPitch);
-	}
+	++SlowMoToggles;
+	FlushSlowMoRequest();
 
 	CustomTimeDilation = 1.f;
 	if (AController* C = GetController())
@@ -329,15 +801,43 @@ void AObstacleAssualtCharacter::StopSlowMo()
 			AsActor->CustomTimeDilation = 1.f;
 }
 
-void AObstacleAssualtCharacter::ServerSetSlowMo_Implementation(bool bEnable, float NewGlobalDilation)
+void AObstacleAssualtCharacter::FlushSlowMoRequest(bool bForce)
+{
+	if (bIsSlowMo == bSlowMoRequestSent) return;
+
+	// 게임 시간은 슬로우에 늘어나므로 실시간 기준. 막히면 Tick 에서 다시 시도
+	const double Now = FPlatformTime::Seconds();
+	if (!bForce && Now - LastSlowMoRequestSeconds < CVarTimeDilationRequestInterval.GetValueOnGameThread()) return;
+
+	bSlowMoRequestSent = bIsSlowMo;
+	LastSlowMoRequestSeconds = Now;
+	++SlowMoRequestsSent;
+	ServerSetSlowMoRequest(bIsSlowMo);
+}
+
+FString AObstacleAssualtCharacter::DescribeSlowMoRequests() const
+{
+	return FString::Printf(TEXT("%s: %d slow-mo toggles, %d request RPCs sent (%d coalesced)"),
+		*GetName(), SlowMoToggles, SlowMoRequestsSent, FMath::Max(0, SlowMoToggles - SlowMoRequestsSent));
+}
+
+void AObstacleAssualtCharacter::ServerSetSlowMoRequest_Implementation(bool bEnable)
 {
 	UWorld* World = GetWorld();
 	if (!World) return;
 
+	// 딜레이션 값은 클라이언트가 보낸 것이 아니라 서버 쪽 설정을 사용. 관리자가 모든 플레이어 요청을 합침
+	if (AObstacleAssualtGameState* GameState = World->GetGameState<AObstacleAssualtGameState>())
+	{
+		GameState->SetSlowMoRequest(this, bEnable, GlobalTimeDilation);
+		return;
+	}
+
+	// 게임 모드가 다른 GameState 를 쓰면 예전처럼 바로 적용
 	if (bEnable)
 	{
 		// 전체(플레이어 포함) 느려짐
-		UGameplayStatics::SetGlobalTimeDilation(World, FMath::Clamp(NewGlobalDilation, 0.01f, 1.f));
+		UGameplayStatics::SetGlobalTimeDilation(World, FMath::Clamp(GlobalTimeDilation, 0.01f, 1.f));
 	}
 	else
 	{
@@ -362,28 +862,57 @@ void AObstacleAssualtCharacter::OnCapsuleHit(
 	if (!World) return;
 
 	const float Now = World->GetTimeSeconds();
-	if (Now - LastAutoClimbTime < AutoClimbCooldown) return;
 
-	// 공중에서만 자동 발동
+	// 태그 필터(선택). 인스턴스 레이아웃(ACourseLayoutActor)은 컴포넌트 태그로 표시
+	if (bUseActorTagFilter && !OtherActor->ActorHasTag(ClimbableTag) && !(OtherComp && OtherComp->ComponentHasTag(ClimbableTag))) return;
+
+	// 쿨다운 → 공중 여부 → 벽 법선(경사/바닥 제외) → 정면 접근 → 충돌 속도 순으로 판정
 	const UCharacterMovementComponent* Move = GetCharacterMovement();
-	if (bRequireAirborne && Move && !Move->IsFalling()) return;
 
-	// 태그 필터(선택)
-	if (bUseActorTagFilter && !OtherActor->ActorHasTag(ClimbableTag)) return;
+	GameplayMath::FAutoClimbParams ClimbParams;
+	ClimbParams.Cooldown = AutoClimbCooldown;
+	ClimbParams.MinImpactSpeed = MinImpactSpeed;
+	ClimbParams.MinApproachDot = MinApproachDot;
+	ClimbParams.bRequireAirborne = bRequireAirborne;
+
+	GameplayMath::FAutoClimbInput ClimbInput;
+	ClimbInput.Now = Now;
+	ClimbInput.LastAutoClimbTime = LastAutoClimbTime;
+	ClimbInput.bFalling = !Move || Move->IsFalling();
+	ClimbInput.Forward = ToGameplayMath(GetActorForwardVector());
+	ClimbInput.WallNormal = ToGameplayMath(Hit.ImpactNormal);
+	ClimbInput.Velocity = ToGameplayMath(GetVelocity());
+
+	double Approach = 0.0;
+	switch (GameplayMath::EvaluateAutoClimb(ClimbParams, ClimbInput, Approach))
+	{
+	case GameplayMath::EAutoClimbDecision::Accept:
+		break;
 
-	// ‘벽’ 성격 판정: 법선이 수직에 가깝고(Z 작아야), 정면 접근이어야
-	const FVector WallNormal = Hit.ImpactNormal.GetSafeNormal();
-	if (WallNormal.Z > 0.3f) return; // 경사/바닥은 제외
+	// 여기부터는 벽에 제대로 부딪힌 경우라 거절 사유를 텔레메트리에 남김
+	case GameplayMath::EAutoClimbDecision::Approach:
+		if (Telemetry) Telemetry->Record(ETelemetryEvent::AutoClimbReject, this, Approach, (uint8)ETelemetryClimbReject::Approach);
+		return;
 
-	const float Approach = FVector::DotProduct(GetActorForwardVector(), -WallNormal);
-	if (Approach < MinApproachDot) return;
+	case GameplayMath::EAutoClimbDecision::ImpactSpeed:
+		if (Telemetry) Telemetry->Record(ETelemetryEvent::AutoClimbReject, this, GetVelocity().Size(), (uint8)ETelemetryClimbReject::ImpactSpeed);
+		return;
 
-	// 너무 살짝 닿은 경우 무시
-	if (Move && Move->Velocity.SizeSquared() < (MinImpactSpeed * MinImpactSpeed)) return;
+	default:
+		return;
+	}
 
 	// 실제 올라설 수 있는 엣지인지 정밀 탐지
 	FLedgeInfo Info;
-	if (!FindLedge(Info)) return;
+	{
+		FHitchScope HitchScope(HitchRecorder, EHitchScope::LedgeDetect);
+		if (!FindLedge(Info))
+		{
+			if (Telemetry) Telemetry->Record(ETelemetryEvent::AutoClimbReject, this, 0.f, (uint8)ETelemetryClimbReject::NoLedge);
+			return;
+		}
+	}
+	if (HitchRecorder) HitchRecorder->NoteClimbEvent(EHitchClimbEvent::AutoClimb);
 
 	// 온리업 느낌: 닿자마자 등반
 	EnterHang(Info);
@@ -403,13 +932,12 @@ bool AObstacleAssualtCharacter::FindLedge(FLedgeInfo& OutInfo) const
 	const float Radius = Cap->GetScaledCapsuleRadius();
 
 	const FVector Loc = GetActorLocation();
-	const FRotator YawRot(0.f, GetActorRotation().Yaw, 0.f);
-	const FVector Forward = FRotationMatrix(YawRot).GetUnitAxis(EAxis::X);
 
 	// 1) 가슴 높이에서 전방 라인트레이스 -> 벽 맞기
-	const FVector Chest = Loc + FVector(0, 0, HalfHeight * 0.5f);
-	const FVector Start = Chest;
-	const FVector End = Chest + Forward * (ForwardCheckDistance + Radius);
+	GameplayMath::FVec3 WallStart, WallEnd;
+	GameplayMath::ComputeWallProbe(ToGameplayMath(Loc), GetActorRotation().Yaw, HalfHeight, Radius, ForwardCheckDistance, WallStart, WallEnd);
+	const FVector Start = FromGameplayMath(WallStart);
+	const FVector End = FromGameplayMath(WallEnd);
 
 	FHitResult WallHit;
 	FCollisionQueryParams Params(SCENE_QUERY_STAT(LedgeWall), false, this);
@@ -417,12 +945,13 @@ bool AObstacleAssualtCharacter::FindLedge(FLedgeInfo& OutInfo) const
 	if (!bHitWall) return false;
 
 	// 벽 성격: 거의 수직(법선 Z가 작아야)
-	if (WallHit.ImpactNormal.Z > 0.3f) return false;
+	if (!GameplayMath::IsWallNormal(ToGameplayMath(WallHit.ImpactNormal))) return false;
 
 	// 2) 벽 위로 올라가서 아래로 캐스트 -> 상면 찾기
-	const FVector Up = FVector::UpVector;
-	const FVector OverTopStart = WallHit.ImpactPoint + Up * UpCheckHeight - WallHit.ImpactNormal * 10.f;
-	const FVector OverTopEnd = OverTopStart - Up * DownCheckDepth;
+	GameplayMath::FVec3 TopStart, TopEnd;
+	GameplayMath::ComputeTopProbe(ToGameplayMath(WallHit.ImpactPoint), ToGameplayMath(WallHit.ImpactNormal), UpCheckHeight, DownCheckDepth, TopStart, TopEnd);
+	const FVector OverTopStart = FromGameplayMath(TopStart);
+	const FVector OverTopEnd = FromGameplayMath(TopEnd);
 
 	FHitResult TopHit;
 	const bool bHitTop = GetWorld()->LineTraceSingleByChannel(TopHit, OverTopStart, OverTopEnd, ECC_Visibility, Params);
@@ -430,9 +959,7 @@ bool AObstacleAssualtCharacter::FindLedge(FLedgeInfo& OutInfo) const
 
 	// 높이 범위 체크
 	const float EdgeHeight = TopHit.ImpactPoint.Z;
-	const float CharFeetZ = Loc.Z - HalfHeight;
-	const float HeightDelta = EdgeHeight - CharFeetZ;
-	if (HeightDelta < MinLedgeHeight || HeightDelta > MaxLedgeHeight) return false;
+	if (!GameplayMath::IsLedgeHeightInRange(EdgeHeight, Loc.Z, HalfHeight, MinLedgeHeight, MaxLedgeHeight)) return false;
 
 	OutInfo.WallImpactPoint = WallHit.ImpactPoint;
 	OutInfo.WallNormal = WallHit.ImpactNormal.GetSafeNormal();
@@ -447,6 +974,8 @@ void AObstacleAssualtCharacter::EnterHang(const FLedgeInfo& Info)
 	bIsHanging = true;
 	CurrentLedge = Info;
 
+	if (Telemetry) Telemetry->Record(ETelemetryEvent::Hang, this, Info.LedgeHeightWorld);
+
 	// 이동/중력 잠금
 	if (UCharacterMovementComponent* Move = GetCharacterMovement())
 	{
@@ -460,15 +989,12 @@ void AObstacleAssualtCharacter::EnterHang(const FLedgeInfo& Info)
 	const UCapsuleComponent* Cap = GetCapsuleComponent();
 	const float HalfHeight = Cap ? Cap->GetScaledCapsuleHalfHeight() : 88.f;
 
-	const FVector OutFromWall = -Info.WallNormal; // 벽을 바라보도록
-	const FVector HangBase =
-		FVector(Info.LedgeTopPoint.X, Info.LedgeTopPoint.Y, Info.LedgeTopPoint.Z) +
-		OutFromWall * HangOffsetFromEdge +
-		FVector(0, 0, HangZOffset + HalfHeight);
+	// 벽을 바라보도록
+	const GameplayMath::FHangPose Pose = GameplayMath::ComputeHangPose(
+		ToGameplayMath(Info.LedgeTopPoint), ToGameplayMath(Info.WallNormal), HangOffsetFromEdge, HangZOffset, HalfHeight);
 
-	const FRotator TargetRot = FRotationMatrix::MakeFromXZ(OutFromWall, FVector::UpVector).Rotator();
-	SetActorLocation(HangBase, false, nullptr, ETeleportType::TeleportPhysics);
-	SetActorRotation(FRotator(0.f, TargetRot.Yaw, 0.f));
+	SetActorLocation(FromGameplayMath(Pose.Location), false, nullptr, ETeleportType::TeleportPhysics);
+	SetActorRotation(FRotator(0.f, Pose.YawDegrees, 0.f));
 }
 
 void AObstacleAssualtCharacter::ClimbUpFromLedge()
@@ -476,14 +1002,12 @@ void AObstacleAssualtCharacter::ClimbUpFromLedge()
 	if (!bIsHanging) return;
 
 	const float StepForward = 30.f; // 벽 넘어 조금 전진
-	const FVector Forward = (-CurrentLedge.WallNormal);
-
-	FVector Target = CurrentLedge.LedgeTopPoint + Forward * StepForward;
+	const UCapsuleComponent* Cap = GetCapsuleComponent();
+	const float HalfHeight = Cap ? Cap->GetScaledCapsuleHalfHeight() : 88.f;
 
-	if (const UCapsuleComponent* Cap = GetCapsuleComponent())
-	{
-		Target.Z += Cap->GetScaledCapsuleHalfHeight() + 2.f; // 발이 상면 위로
-	}
+	// 발이 상면 위로
+	const FVector Target = FromGameplayMath(GameplayMath::ComputeClimbUpTarget(
+		ToGameplayMath(CurrentLedge.LedgeTopPoint), ToGameplayMath(CurrentLedge.WallNormal), StepForward, HalfHeight));
 
 	SetActorLocation(Target, false, nullptr, ETeleportType::TeleportPhysics);
 
@@ -492,6 +1016,9 @@ void AObstacleAssualtCharacter::ClimbUpFromLedge()
 
 void AObstacleAssualtCharacter::DropFromLedge()
 {
+	if (HitchRecorder) HitchRecorder->NoteClimbEvent(EHitchClimbEvent::Drop);
+	if (Telemetry) Telemetry->Record(ETelemetryEvent::Drop, this);
+
 	bIsHanging = false;
 
 	if (UCharacterMovementComponent* Move = GetCharacterMovement())
@@ -506,6 +1033,10 @@ void AObstacleAssualtCharacter::StartClimbUpSequence()
 {
 	bClimbInProgress = true; // 시퀀스 시작
 
+	FHitchScope HitchScope(HitchRecorder, EHitchScope::ClimbSequence);
+	if (HitchRecorder) HitchRecorder->NoteClimbEvent(EHitchClimbEvent::ClimbStart);
+	if (Telemetry) Telemetry->Record(ETelemetryEvent::ClimbStart, this, CurrentLedge.LedgeHeightWorld);
+
 	if (UCharacterMovementComponent* Move = GetCharacterMovement())
 	{
 		Move->StopMovementImmediately();
@@ -537,16 +1068,18 @@ void AObstacleAssualtCharacter::StartClimbUpSequence()
 // AnimNotify(ClimbCommit)에서 부르는 함수
 void AObstacleAssualtCharacter::ClimbUpCommit()
 {
+	if (HitchRecorder) HitchRecorder->NoteClimbEvent(EHitchClimbEvent::ClimbCommit);
+	if (Telemetry) Telemetry->Record(ETelemetryEvent::ClimbCommit, this);
+
 	if (bClimbUsesRootMotion) return; // 루트모션이면 이동 안 함
 
 	const float StepForward = 30.f;
 	const FVector Forward = (-CurrentLedge.WallNormal);
 
-	FVector Target = CurrentLedge.LedgeTopPoint + Forward * StepForward;
-	if (const UCapsuleComponent* Cap = GetCapsuleComponent())
-	{
-		Target.Z += Cap->GetScaledCapsuleHalfHeight() + 2.f;
-	}
+	const UCapsuleComponent* Cap = GetCapsuleComponent();
+	const float HalfHeight = Cap ? Cap->GetScaledCapsuleHalfHeight() : 88.f;
+	const FVector Target = FromGameplayMath(GameplayMath::ComputeClimbUpTarget(
+		ToGameplayMath(CurrentLedge.LedgeTopPoint), ToGameplayMath(CurrentLedge.WallNormal), StepForward, HalfHeight));
 
 	SetActorLocation(Target, false, nullptr, ETeleportType::TeleportPhysics);
 
@@ -559,6 +1092,9 @@ void AObstacleAssualtCharacter::ClimbUpCommit()
 
 void AObstacleAssualtCharacter::FinishClimbUpSequence()
 {
+	if (HitchRecorder) HitchRecorder->NoteClimbEvent(EHitchClimbEvent::ClimbFinish);
+	if (Telemetry) Telemetry->Record(ETelemetryEvent::ClimbFinish, this);
+
 	if (UCharacterMovementComponent* Move = GetCharacterMovement())
 	{
 		// 루트모션 모드 원복
@@ -7,6 +7,7 @@
 #include "Animation/AnimTypes.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Logging/LogMacros.h"
+#include "CourseSnapshotSubsystem.h"
 #include "ObstacleAssualtCharacter.generated.h"
 
 USTRUCT(BlueprintType)
@@ -23,8 +24,27 @@ struct FLedgeInfo
 	bool IsValid() const { return HitActor != nullptr; }
 };
 
+/** 체크포인트 리스폰용 러너 상태 */
+struct FRunnerSnapshot
+{
+	FTransform Transform;
+	FRotator ControlRotation = FRotator::ZeroRotator;
+	FVector Velocity = FVector::ZeroVector;
+	uint8 MovementMode = MOVE_Walking;
+	uint8 CustomMovementMode = 0;
+	float GravityScale = 1.f;
+	bool bIsSlowMo = false;
+	/** 플레이타임 타이머는 시작 시각이 아니라 경과 시간으로 저장 */
+	float ElapsedGameSeconds = 0.f;
+	float ElapsedRealSeconds = 0.f;
+	/** 이 체크포인트 시점의 발판 위상 (스탠드얼론만). 러너마다 따로 두어 다른 러너의 저장이 덮지 않음 */
+	FCourseSnapshot Course;
+};
+
 class USpringArmComponent;
 class UCameraComponent;
+class UCameraOcclusionComponent;
+class UInputLatencyComponent;
 class UInputMappingContext;
 class UInputAction;
 struct FInputActionValue;
@@ -33,8 +53,11 @@ class UPrimitiveComponent;
 class UCapsuleComponent;
 class USoundBase;
 class UAudioComponent;
+class UStreamingBGMSound;
 class UMaterialInterface;
 class UMaterialInstanceDynamic;
+class UHitchRecorderSubsystem;
+class UTelemetrySubsystem;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogTemplateCharacter, Log, All);
 
@@ -54,6 +77,14 @@ class AObstacleAssualtCharacter : public ACharacter
 	/** Follow camera */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Components", meta = (AllowPrivateAccess = "true"))
 	UCameraComponent* FollowCamera;
+
+	/** Async occlusion probe driving the camera boom length */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Components", meta = (AllowPrivateAccess = "true"))
+	UCameraOcclusionComponent* CameraOcclusion;
+
+	/** Input-to-frame latency instrumentation and late look sampling */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Components", meta = (AllowPrivateAccess = "true"))
+	UInputLatencyComponent* InputLatency;
 	
 protected:
 	bool bIsHanging = false;
@@ -106,9 +137,12 @@ protected:
 	UFUNCTION()
 	void StopSlowMo();
 
-	/** 서버에서만 전역 타임 딜레이션 설정 */
+	/** 서버의 AObstacleAssualtGameState 에 슬로우 요청 전달 (누를 때마다가 아니라 FlushSlowMoRequest 로 모아서) */
 	UFUNCTION(Server, Reliable)
-	void ServerSetSlowMo(bool bEnable, float NewGlobalDilation);
+	void ServerSetSlowMoRequest(bool bEnable);
+
+	/** 마지막으로 보낸 상태와 다르면 전송. oa.TimeDilation.RequestInterval 마다 최대 한 번, bForce 면 즉시 */
+	void FlushSlowMoRequest(bool bForce = false);
 
 	/** 전역 시간 배율 (플레이어 포함 전체 느려짐) */
 	UPROPERTY(EditDefaultsOnly, Category = "SlowMo")
@@ -124,18 +158,39 @@ protected:
 	/** 슬로우 중 중복 호출 방지용 */
 	bool bIsSlowMo = false;
 
+	/** 서버에 마지막으로 보낸 슬로우 상태와 시각 (실시간) */
+	bool bSlowMoRequestSent = false;
+	double LastSlowMoRequestSeconds = -1000.0;
+
+	/** 입력으로 슬로우를 켜고 끈 횟수 / 실제 보낸 RPC 수 */
+	int32 SlowMoToggles = 0;
+	int32 SlowMoRequestsSent = 0;
+
 	// BGM(2D)
 	UPROPERTY(EditAnywhere, Category = "Audio|BGM")
 	TObjectPtr<USoundBase> BGM;
 
+	/**
+	 *  디스크에서 청크로 스트리밍할 16비트 PCM WAV (Content 기준 상대 경로). 지정하면 BGM 대신 사용.
+	 *  읽기 스레드와 청크 캐시는 로컬 조종 러너에만 만들고, 원격 러너는 음악을 재생하지 않는다
+	 */
+	UPROPERTY(EditAnywhere, Category = "Audio|BGM")
+	FString BGMStreamFile;
+
 	/** 2D 음악을 관리할 오디오 컴포넌트 */
 	UPROPERTY(Transient)
 	TObjectPtr<UAudioComponent> BGMComponent;
 
+	UPROPERTY(Transient)
+	TObjectPtr<UStreamingBGMSound> StreamingBGM;
+
 	/** 평소 피치 */
 	UPROPERTY(EditAnywhere, Category = "Audio|BGM")
 	float NormalPitch = 1.0f;
 
+	/** 마지막으로 적용한 BGM 재생 속도 (NormalPitch × 실제 타임 딜레이션). 바뀔 때만 다시 적용 */
+	float AppliedBGMRate = -1.f;
+
 	/** Post Process 머티리얼 (M_Desaturate_PP) */
 	UPROPERTY(EditDefaultsOnly, Category = "PostProcess")
 	TObjectPtr<UMaterialInterface> DesaturatePPMaterial = nullptr;
@@ -147,6 +202,10 @@ protected:
 	/** 목표 디새츄레이션 값(0~1), 틱에서 부드럽게 보간 */
 	float TargetDesat = 0.f;
 
+	/** 딜레이션이 GlobalTimeDilation 까지 내려갔을 때의 디새츄레이션 (그 사이는 비례) */
+	UPROPERTY(EditDefaultsOnly, Category = "PostProcess")
+	float SlowMoDesat = 0.4f;
+
 	/** 보간 속도 (값/초) */
 	UPROPERTY(EditDefaultsOnly, Category = "PostProcess")
 	float DesatInterpSpeed = 6.0f;
@@ -193,6 +252,18 @@ protected:
 
 	float LastAutoClimbTime = -1000.f;
 
+	/** 마지막 체크포인트 */
+	FRunnerSnapshot Checkpoint;
+	bool bHasCheckpoint = false;
+
+	/** 히치 기록기 (BeginPlay에서 캐시) */
+	UPROPERTY(Transient)
+	TObjectPtr<UHitchRecorderSubsystem> HitchRecorder;
+
+	/** 텔레메트리 (꺼져 있으면 nullptr, BeginPlay에서 캐시) */
+	UPROPERTY(Transient)
+	TObjectPtr<UTelemetrySubsystem> Telemetry;
+
 	// ====== Ledge Detect Params ======
 	UPROPERTY(EditAnywhere, Category = "Ledge|Trace")
 	float ForwardCheckDistance = 70.f;   // 앞벽 감지 거리(가슴 위치 기준)
@@ -238,6 +309,27 @@ protected:
 	// 등반 종료 시 바닥으로 스냅
 	void SnapCapsuleToFloor(float DownTrace = 120.f, float UpTolerance = 10.f);
 
+	/** 로컬 플레이어 입력 서브시스템에 PlayerIMC 추가 */
+	void ApplyInputMappingContext();
+
+	/** BGM 컴포넌트 / 디새츄레이션 MID / 플레이타임 위젯 준비. 이미 있으면 재사용 */
+	void InitPresentation(bool bStartPlayback);
+
+	/** 음악/포스트프로세스/위젯/카메라 같은 표시 작업을 할지 (데디케이티드 서버는 false) */
+	bool HasPresentation() const;
+
+	/** 데디케이티드 서버에서 표시 전용 컴포넌트 틱/애니메이션 끄기 */
+	void StripPresentationForServer();
+
+	/**
+	 *  BGM 컴포넌트와 재생할 음악 준비. 스트리밍 BGM 은 로컬 조종 러너만 연다 (원격 러너는 음악 없음).
+	 *  bRestart 면 처음부터 재생하고, 아니면 음악이 바뀐 경우에만 재생 시작
+	 */
+	void InitBGM(bool bRestart);
+
+	/** BGM 재생 속도를 월드의 실제 타임 딜레이션에 맞춤 (값이 바뀐 프레임에만 적용) */
+	void UpdateBGMRate();
+
 public:
 
 	/** Handles move inputs from either controls or UI interfaces */
@@ -258,8 +350,49 @@ public:
 
 	void BeginPlay() override;
 
+	void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	void Tick(float DeltaTime) override;
 
+	/** 빙의/해제 (서버 PossessedBy·UnPossessed, 클라이언트 OnRep_Controller) 때 로컬 전용 컴포넌트 재평가 */
+	virtual void NotifyControllerChanged() override;
+
+	/** 위험 요소 넉백 (UHazardSubsystem에서 호출). 매달림/등반 중에는 무시 */
+	void ApplyHazardKnockback(const FVector& LaunchVelocity);
+
+	/**
+	 *  현재 러너 상태 + (스탠드얼론이면) 코스 발판 위상을 체크포인트로 저장.
+	 *  매달림/등반 중에는 저장하지 않고 이전 체크포인트 유지 (복원해도 등반을 끝낼 콜백이 없으므로)
+	 */
+	UFUNCTION(BlueprintCallable, Category="Checkpoint")
+	void SaveCheckpoint();
+
+	/** 마지막 체크포인트로 같은 프레임 안에서 제자리 복원 */
+	UFUNCTION(BlueprintCallable, Category="Checkpoint")
+	void RespawnAtCheckpoint();
+
+	void CaptureRunnerState(FRunnerSnapshot& OutSnapshot) const;
+	void RestoreRunnerState(const FRunnerSnapshot& Snapshot);
+
+	/** 킬Z 아래로 떨어지면 파괴 대신 체크포인트 리스폰 */
+	virtual void FellOutOfWorld(const class UDamageType& DmgType) override;
+
+	/** 풀에서 꺼낼 때 (빙의 직후) 재생성 없이 상태 재초기화 */
+	void ResetForReuse();
+
+	/** 풀로 돌려보낼 때 (빙의 해제 직전) 숨김/정지 */
+	void DeactivateForPool();
+
+	/** URunnerPoolSubsystem이 미리 만드는 인스턴스 (BeginPlay에서 바로 비활성화) */
+	bool bSpawnedForPool = false;
+
+	/** 슬로우 입력 횟수 대비 보낸 요청 RPC 수 (oa.TimeDilation.Stats) */
+	FString DescribeSlowMoRequests() const;
+
+private:
+	/** 원격 러너의 InitPresentation 이 UCourseInitSchedulerSubsystem 에 예약되어 아직 안 돌았는지 */
+	bool bPresentationPending = false;
+
 public:
 
 	/** Returns CameraBoom subobject **/
@@ -267,6 +400,19 @@ public:
 
 	/** Returns FollowCamera subobject **/
 	FORCEINLINE class UCameraComponent* GetFollowCamera() const { return FollowCamera; }
+
+	/** Returns InputLatency subobject **/
+	FORCEINLINE UInputLatencyComponent* GetInputLatency() const { return InputLatency; }
+
+	/** 입력 지연 자동화 테스트가 Enhanced Input 으로 주입하는 액션과 그 결과 */
+	FORCEINLINE const UInputAction* GetLookAction() const { return LookAction; }
+	FORCEINLINE const UInputAction* GetSlowMoAction() const { return SlowMoAction; }
+	FORCEINLINE bool IsSlowMoActive() const { return bIsSlowMo; }
+
+#if WITH_DEV_AUTOMATION_TESTS
+	/** 등반 중 체크포인트 테스트가 매달림/등반 상태를 직접 만들고 확인 */
+	friend class FCheckpointMidClimbCommand;
+#endif
 };
 
 
@@ -0,0 +1,236 @@
+#include "ObstacleAssualtGameState.h"
+#include "ObstacleAssualtCharacter.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/WorldSettings.h"
+#include "HAL/IConsoleManager.h"
+#include "Net/UnrealNetwork.h"
+#include "ObstacleAssualt.h"
+
+static TAutoConsoleVariable<float> CVarTimeDilationMinInterval(
+	TEXT("oa.TimeDilation.MinInterval"),
+	0.25f,
+	TEXT("전역 딜레이션 목표를 바꾸는 최소 간격 (실시간 초). 그 사이 요청은 합쳐서 한 번에 반영"));
+
+static TAutoConsoleVariable<float> CVarTimeDilationRampSeconds(
+	TEXT("oa.TimeDilation.RampSeconds"),
+	0.15f,
+	TEXT("목표 딜레이션까지 보간하는 시간 (서버 월드 시간 초, 0이면 즉시)"));
+
+static FAutoConsoleCommandWithWorld TimeDilationStatsCommand(
+	TEXT("oa.TimeDilation.Stats"),
+	TEXT("슬로우 요청 RPC 수, 딜레이션 상태 복제 횟수/크기 출력"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (!World) return;
+
+		if (const AObstacleAssualtGameState* GameState = World->GetGameState<AObstacleAssualtGameState>())
+		{
+			UE_LOG(LogObstacleAssualt, Display, TEXT("%s"), *GameState->DescribeStats());
+		}
+		for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+		{
+			const APlayerController* PC = It->Get();
+			const AObstacleAssualtCharacter* Runner = PC && PC->IsLocalController() ? Cast<AObstacleAssualtCharacter>(PC->GetPawn()) : nullptr;
+			if (Runner)
+			{
+				UE_LOG(LogObstacleAssualt, Display, TEXT("%s"), *Runner->DescribeSlowMoRequests());
+			}
+		}
+	}));
+
+namespace TimeDilationNet
+{
+	/** 복제되는 상태 한 번의 크기 (NetSerialize 기준) */
+	static const int32 StateBits = 16 + 16 + 32 + 16;
+
+	FORCEINLINE uint16 QuantizeUnit(float Value) { return (uint16)FMath::RoundToInt(FMath::Clamp(Value, 0.f, 1.f) * 65535.f); }
+	FORCEINLINE float DequantizeUnit(uint16 Value) { return Value / 65535.f; }
+}
+
+bool FTimeDilationState::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	uint16 QFrom = Ar.IsSaving() ? TimeDilationNet::QuantizeUnit(From) : 0;
+	uint16 QTarget = Ar.IsSaving() ? TimeDilationNet::QuantizeUnit(Target) : 0;
+	uint16 RampMs = Ar.IsSaving() ? (uint16)FMath::Clamp(FMath::RoundToInt(RampSeconds * 1000.f), 0, 65535) : 0;
+
+	Ar << QFrom;
+	Ar << QTarget;
+	Ar << RampStartSeconds;
+	Ar << RampMs;
+
+	if (Ar.IsLoading())
+	{
+		From = TimeDilationNet::DequantizeUnit(QFrom);
+		Target = TimeDilationNet::DequantizeUnit(QTarget);
+		RampSeconds = RampMs / 1000.f;
+	}
+
+	bOutSuccess = true;
+	return true;
+}
+
+AObstacleAssualtGameState::AObstacleAssualtGameState()
+{
+	// 램프 중에만 틱 (평소에는 할 일 없음)
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
+	PrimaryActorTick.TickGroup = TG_PrePhysics;
+}
+
+void AObstacleAssualtGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(AObstacleAssualtGameState, TimeDilationState);
+}
+
+void AObstacleAssualtGameState::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	if (HasAuthority())
+	{
+		UpdateServerTimeDilation();
+	}
+	ApplyTimeDilation();
+}
+
+float AObstacleAssualtGameState::GetPredictedTimeDilation() const
+{
+	return TimeDilationState.Evaluate(GetServerWorldTimeSeconds());
+}
+
+void AObstacleAssualtGameState::SetSlowMoRequest(const AActor* Requester, bool bEnable, float Dilation)
+{
+	if (!HasAuthority() || !Requester) return;
+
+	FSlowMoRequester& Entry = Requesters.FindOrAdd(Requester);
+	Entry.Name = Requester->GetName();
+	Entry.Dilation = FMath::Clamp(Dilation, 0.01f, 1.f);
+	Entry.bActive = bEnable;
+	++Entry.Requests;
+
+	++RequestsReceived;
+	if (FirstRequestRealSeconds < 0.0)
+	{
+		FirstRequestRealSeconds = GetWorld()->GetRealTimeSeconds();
+	}
+
+	// 실제 반영은 틱에서 (레이트 리밋 안에서 여러 요청을 한 번에)
+	bRequestsDirty = true;
+	SetActorTickEnabled(true);
+}
+
+void AObstacleAssualtGameState::ClearSlowMoRequest(const AActor* Requester)
+{
+	if (!HasAuthority()) return;
+
+	FSlowMoRequester* Entry = Requesters.Find(Requester);
+	if (Entry && Entry->bActive)
+	{
+		Entry->bActive = false;
+		bRequestsDirty = true;
+		SetActorTickEnabled(true);
+	}
+}
+
+void AObstacleAssualtGameState::UpdateServerTimeDilation()
+{
+	if (!bRequestsDirty) return;
+
+	// 레이트 리밋: 목표를 바꾼 지 얼마 안 됐으면 남은 요청은 다음 허용 시점에 합쳐서
+	const double NowReal = GetWorld()->GetRealTimeSeconds();
+	if (NowReal - LastChangeRealSeconds < CVarTimeDilationMinInterval.GetValueOnGameThread()) return;
+	bRequestsDirty = false;
+
+	// 가장 느린 요청이 이김 (아무도 안 누르면 1)
+	float Target = 1.f;
+	for (const TPair<TObjectKey<AActor>, FSlowMoRequester>& Pair : Requesters)
+	{
+		if (Pair.Value.bActive)
+		{
+			Target = FMath::Min(Target, Pair.Value.Dilation);
+		}
+	}
+
+	if (FMath::IsNearlyEqual(Target, TimeDilationState.Target, 1e-3f)) return;
+
+	const double ServerNow = GetServerWorldTimeSeconds();
+	TimeDilationState.From = TimeDilationState.Evaluate(ServerNow);
+	TimeDilationState.Target = Target;
+	TimeDilationState.RampStartSeconds = (float)ServerNow;
+	TimeDilationState.RampSeconds = FMath::Max(0.f, CVarTimeDilationRampSeconds.GetValueOnGameThread());
+
+	LastChangeRealSeconds = NowReal;
+	++StateChanges;
+	ForceNetUpdate();
+}
+
+void AObstacleAssualtGameState::OnRep_TimeDilationState()
+{
+	++StateUpdatesReceived;
+
+	// 받은 즉시 한 번 맞추고, 램프가 남았으면 끝날 때까지 틱
+	ApplyTimeDilation();
+}
+
+void AObstacleAssualtGameState::ApplyTimeDilation()
+{
+	const double ServerNow = GetServerWorldTimeSeconds();
+	const float Dilation = TimeDilationState.Evaluate(ServerNow);
+	const bool bRamping = TimeDilationState.IsRamping(ServerNow);
+
+	// 복제되는 기준값: 서버가 램프가 끝난 목표값으로만 바꿈
+	AWorldSettings* Settings = GetWorldSettings();
+	if (Settings && HasAuthority() && !bRamping && !FMath::IsNearlyEqual(Settings->TimeDilation, Dilation, 1e-4f))
+	{
+		Settings->SetTimeDilation(Dilation);
+		++WorldSettingsWrites;
+	}
+
+	// 램프 중간값 / 아직 도착하지 않은 기준값과의 차이는 복제되지 않는 로컬 배율로
+	if (Settings && !GetWorld()->IsPlayingReplay())
+	{
+		const float LocalScale = Dilation / FMath::Max(Settings->TimeDilation, KINDA_SMALL_NUMBER);
+		if (!FMath::IsNearlyEqual(Settings->DemoPlayTimeDilation, LocalScale, 1e-4f))
+		{
+			Settings->DemoPlayTimeDilation = LocalScale;
+		}
+	}
+
+	// 클라이언트는 기준값이 목표로 복제될 때까지 배율을 계속 맞춤 (GameState 와 WorldSettings 도착 순서와 무관)
+	const bool bBaseSettled = !Settings || FMath::IsNearlyEqual(Settings->TimeDilation, Dilation, 1e-3f);
+	const bool bKeepTicking = bRamping || !bBaseSettled || (HasAuthority() && bRequestsDirty);
+	if (IsActorTickEnabled() != bKeepTicking)
+	{
+		SetActorTickEnabled(bKeepTicking);
+	}
+}
+
+FString AObstacleAssualtGameState::DescribeStats() const
+{
+	FString Out = FString::Printf(TEXT("TimeDilation: target %.2f, now %.2f | state updates: %d sent, %d received, %d bits each"),
+		TimeDilationState.Target, GetPredictedTimeDilation(), StateChanges, StateUpdatesReceived, TimeDilationNet::StateBits);
+
+	// 복제되는 WorldSettings 값과 로컬 램프 배율 (둘의 곱이 실제 딜레이션)
+	if (const AWorldSettings* Settings = GetWorldSettings())
+	{
+		Out += FString::Printf(TEXT(" | WorldSettings: TimeDilation %.3f (replicated, %d server writes), DemoPlayTimeDilation %.3f (local ramp), effective %.3f"),
+			Settings->TimeDilation, WorldSettingsWrites, Settings->DemoPlayTimeDilation, Settings->GetEffectiveTimeDilation());
+	}
+
+	if (HasAuthority())
+	{
+		const double Seconds = FirstRequestRealSeconds >= 0.0 ? GetWorld()->GetRealTimeSeconds() - FirstRequestRealSeconds : 0.0;
+		Out += FString::Printf(TEXT(" | server: %d slow-mo RPCs from %d runners over %.1f s, %d merged or rate-limited"),
+			RequestsReceived, Requesters.Num(), Seconds, FMath::Max(0, RequestsReceived - StateChanges));
+
+		for (const TPair<TObjectKey<AActor>, FSlowMoRequester>& Pair : Requesters)
+		{
+			Out += FString::Printf(TEXT("\n  %s: %d RPCs (%.2f/s)%s"), *Pair.Value.Name, Pair.Value.Requests,
+				Seconds > 0.0 ? Pair.Value.Requests / Seconds : 0.0, Pair.Value.bActive ? TEXT(", slow-mo") : TEXT(""));
+		}
+	}
+	return Out;
+}
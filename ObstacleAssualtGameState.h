@@ -0,0 +1,128 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/GameStateBase.h"
+#include "UObject/ObjectKey.h"
+#include "ObstacleAssualtGameState.generated.h"
+
+/**
+ *  서버가 정한 전역 타임 딜레이션 램프
+ *  From → Target 으로 RampStartSeconds(서버 월드 시간)부터 RampSeconds 동안 선형 보간.
+ *  클라이언트는 이 값만 받아 GetServerWorldTimeSeconds 로 같은 램프를 직접 계산한다.
+ */
+USTRUCT()
+struct FTimeDilationState
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	float From = 1.f;
+
+	UPROPERTY()
+	float Target = 1.f;
+
+	UPROPERTY()
+	float RampStartSeconds = 0.f;
+
+	UPROPERTY()
+	float RampSeconds = 0.f;
+
+	float Evaluate(double ServerSeconds) const
+	{
+		if (RampSeconds <= 0.f) return Target;
+
+		const float Alpha = FMath::Clamp((float)((ServerSeconds - RampStartSeconds) / RampSeconds), 0.f, 1.f);
+		return FMath::Lerp(From, Target, Alpha);
+	}
+
+	bool IsRamping(double ServerSeconds) const
+	{
+		return RampSeconds > 0.f && ServerSeconds < RampStartSeconds + RampSeconds;
+	}
+
+	/** 딜레이션 두 개는 [0, 1] 16비트, 램프 길이는 ms 16비트로 양자화 (업데이트당 80비트) */
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FTimeDilationState> : public TStructOpsTypeTraitsBase2<FTimeDilationState>
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
+};
+
+/**
+ *  전역 타임 딜레이션 관리자
+ *  플레이어들의 슬로우 요청을 서버가 모아 하나의 목표로 합치고 (가장 느린 요청 우선),
+ *  목표 변경은 oa.TimeDilation.MinInterval 로 제한한다. 결과는 FTimeDilationState 하나로 복제되고
+ *  서버/클라이언트 모두 램프 중에만 틱하며 월드 딜레이션을 그 값으로 맞춘다.
+ *
+ *  AWorldSettings::TimeDilation 은 그 자체로 복제되는 프로퍼티라 램프 중간값을 쓰면 매 프레임 따로 복제되고,
+ *  늦게 도착한 옛 값이 클라이언트의 예측 램프를 덮는다. 그래서 서버는 램프가 끝난 목표값만 TimeDilation 에
+ *  쓰고 (상태 변경당 한 번), 램프 중간값과 기준값의 차이는 복제되지 않는 DemoPlayTimeDilation 배율로 맞춘다.
+ *  클라이언트는 TimeDilation 을 쓰지 않고 배율만 계산한다 (리플레이 재생 중에는 배율을 데모 드라이버에 맡김).
+ *  게임 모드의 GameStateClass 로 지정해야 한다. 통계: oa.TimeDilation.Stats
+ */
+UCLASS()
+class OBSTACLEASSUALT_API AObstacleAssualtGameState : public AGameStateBase
+{
+	GENERATED_BODY()
+
+public:
+	AObstacleAssualtGameState();
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void Tick(float DeltaSeconds) override;
+
+	/** 서버 전용. Requester 의 슬로우 요청 상태 갱신 (실제 반영은 다음 허용 시점에 합쳐서) */
+	void SetSlowMoRequest(const AActor* Requester, bool bEnable, float Dilation);
+
+	/** 서버 전용. 떠난 러너의 요청 제거 */
+	void ClearSlowMoRequest(const AActor* Requester);
+
+	/** 지금 시점의 딜레이션 (클라이언트는 예측값) */
+	float GetPredictedTimeDilation() const;
+
+	const FTimeDilationState& GetTimeDilationState() const { return TimeDilationState; }
+
+	FString DescribeStats() const;
+
+protected:
+	UFUNCTION()
+	void OnRep_TimeDilationState();
+
+private:
+	/** 요청들을 합쳐 목표가 바뀌었으면 새 램프 시작 (서버) */
+	void UpdateServerTimeDilation();
+
+	/** 월드 딜레이션을 램프 값으로. 램프가 끝나고 복제된 기준값이 목표에 도착하면 틱 끔 */
+	void ApplyTimeDilation();
+
+	UPROPERTY(ReplicatedUsing = OnRep_TimeDilationState)
+	FTimeDilationState TimeDilationState;
+
+	/** 서버: 러너별 요청과 받은 RPC 수 */
+	struct FSlowMoRequester
+	{
+		FString Name;
+		float Dilation = 1.f;
+		bool bActive = false;
+		int32 Requests = 0;
+	};
+	TMap<TObjectKey<AActor>, FSlowMoRequester> Requesters;
+
+	bool bRequestsDirty = false;
+	double LastChangeRealSeconds = -1000.0;
+	double FirstRequestRealSeconds = -1.0;
+
+	int32 RequestsReceived = 0;
+	int32 StateChanges = 0;
+
+	/** 서버: 복제되는 AWorldSettings::TimeDilation 을 바꾼 횟수 (상태 변경 수를 넘으면 안 됨) */
+	int32 WorldSettingsWrites = 0;
+
+	/** 클라이언트: 받은 상태 업데이트 수 */
+	int32 StateUpdatesReceived = 0;
+};
@@ -0,0 +1,315 @@
+#include "ObstacleReplicationGraph.h"
+#include "ReplicationGraphTypes.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerState.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "ObstacleAssualtCharacter.h"
+#include "MovingPlatform.h"
+#include "SplinePathPlatform.h"
+#include "ObstacleAssualt.h"
+
+static TAutoConsoleVariable<int32> CVarObstacleRepGraphEnable(
+	TEXT("oa.RepGraph.Enable"),
+	1,
+	TEXT("게임 넷 드라이버에 UObstacleReplicationGraph 사용 (넷 드라이버 생성 시 적용)"));
+
+const FName UObstacleReplicationGraph::ClimbableTag(TEXT("Climbable"));
+
+namespace ObstacleRepGraph
+{
+	/** 모듈 로드 시 복제 드라이버 생성 델리게이트 등록 */
+	struct FRegistration
+	{
+		FRegistration()
+		{
+			UReplicationDriver::CreateReplicationDriverDelegate().BindLambda([](UNetDriver* ForNetDriver, const FURL& URL, UWorld* World) -> UReplicationDriver*
+			{
+				// 데모/비컨 드라이버는 기본 동작 유지
+				if (!ForNetDriver || ForNetDriver->NetDriverName != NAME_GameNetDriver) return nullptr;
+				if (CVarObstacleRepGraphEnable.GetValueOnAnyThread() == 0) return nullptr;
+
+				return NewObject<UObstacleReplicationGraph>(GetTransientPackage());
+			});
+		}
+	};
+	static FRegistration Registration;
+}
+
+// ------------------------------------------------------------
+// UReplicationGraphNode_CourseProgress
+// ------------------------------------------------------------
+
+UReplicationGraphNode_CourseProgress::UReplicationGraphNode_CourseProgress()
+{
+	bRequiresPrepareForReplicationCall = true;
+}
+
+void UReplicationGraphNode_CourseProgress::NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo)
+{
+	Runners.AddUnique(ActorInfo.Actor);
+}
+
+bool UReplicationGraphNode_CourseProgress::NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound)
+{
+	const bool bRemoved = Runners.RemoveSwap(ActorInfo.Actor) > 0;
+	if (!bRemoved && bWarnIfNotFound)
+	{
+		UE_LOG(LogObstacleAssualt, Warning, TEXT("CourseProgress node: %s was not registered"), *GetNameSafe(ActorInfo.Actor));
+	}
+	return bRemoved;
+}
+
+void UReplicationGraphNode_CourseProgress::NotifyResetAllNetworkActors()
+{
+	Runners.Reset();
+	for (FActorRepListRefView& Bucket : Buckets)
+	{
+		Bucket.Reset();
+	}
+}
+
+int32 UReplicationGraphNode_CourseProgress::BucketIndexFor(const FVector& Location) const
+{
+	const float Progress = FVector::DotProduct(Location - CourseOrigin, CourseDirection);
+	return FMath::Max(0, FMath::FloorToInt(Progress / FMath::Max(1.f, BucketLength)));
+}
+
+void UReplicationGraphNode_CourseProgress::PrepareForReplication()
+{
+	// 프레임당 한 번 러너를 진행도 버킷으로 재분류 (커넥션 수와 무관)
+	for (FActorRepListRefView& Bucket : Buckets)
+	{
+		Bucket.Reset();
+	}
+
+	for (AActor* Runner : Runners)
+	{
+		if (!IsValid(Runner)) continue;
+
+		const int32 Index = BucketIndexFor(Runner->GetActorLocation());
+		if (Index >= Buckets.Num())
+		{
+			Buckets.SetNum(Index + 1);
+		}
+		Buckets[Index].Add(Runner);
+	}
+}
+
+void UReplicationGraphNode_CourseProgress::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+	if (Buckets.Num() == 0) return;
+
+	// 분할 화면 등 뷰어가 여럿이면 모든 뷰어 주변 버킷을 합침 (중복 추가 방지)
+	TArray<int32, TInlineAllocator<8>> Added;
+	for (const FNetViewer& Viewer : Params.Viewers)
+	{
+		const int32 Center = BucketIndexFor(Viewer.ViewLocation);
+		for (int32 Index = Center - NeighbourBuckets; Index <= Center + NeighbourBuckets; ++Index)
+		{
+			if (Index < 0 || Index >= Buckets.Num() || Added.Contains(Index)) continue;
+			Added.Add(Index);
+
+			if (Buckets[Index].Num() > 0)
+			{
+				Params.OutGatheredReplicationLists.AddReplicationActorList(Buckets[Index]);
+			}
+		}
+	}
+}
+
+// ------------------------------------------------------------
+// UObstacleReplicationGraph
+// ------------------------------------------------------------
+
+UObstacleReplicationGraph::UObstacleReplicationGraph()
+{
+}
+
+void UObstacleReplicationGraph::ResetGameWorldState()
+{
+	Super::ResetGameWorldState();
+
+	ReportStartSeconds = 0.0;
+	AccumulatedMs = 0.0;
+	MaxMs = 0.0;
+	AccumulatedFrames = 0;
+}
+
+void UObstacleReplicationGraph::InitGlobalActorClassSettings()
+{
+	Super::InitGlobalActorClassSettings();
+
+	// 기본 규칙 (액터 플래그로 판단하는 경우는 GetRoute 참고)
+	ClassRoutes.Set(AObstacleAssualtCharacter::StaticClass(), EObstacleRepRoute::Runner);
+	ClassRoutes.Set(AMovingPlatform::StaticClass(), EObstacleRepRoute::CourseDormant);
+	ClassRoutes.Set(ASplinePathPlatform::StaticClass(), EObstacleRepRoute::CourseDormant);
+	ClassRoutes.Set(APlayerController::StaticClass(), EObstacleRepRoute::NotRouted);
+	ClassRoutes.Set(AGameStateBase::StaticClass(), EObstacleRepRoute::AlwaysRelevant);
+	ClassRoutes.Set(APlayerState::StaticClass(), EObstacleRepRoute::AlwaysRelevant);
+
+	// 러너: 매 프레임, 거리 컬링은 진행도 노드가 대신함
+	FClassReplicationInfo RunnerInfo;
+	RunnerInfo.ReplicationPeriodFrame = 1;
+	RunnerInfo.SetCullDistanceSquared(0.f);
+	GlobalActorReplicationInfoMap.SetClassInfo(AObstacleAssualtCharacter::StaticClass(), RunnerInfo);
+
+	// PlayerState: 점수/이름 정도라 낮은 빈도로
+	FClassReplicationInfo PlayerStateInfo;
+	PlayerStateInfo.ReplicationPeriodFrame = 10;
+	PlayerStateInfo.SetCullDistanceSquared(0.f);
+	GlobalActorReplicationInfoMap.SetClassInfo(APlayerState::StaticClass(), PlayerStateInfo);
+
+	// 코스 액터: 결정적이라 초기 상태 이후 갱신 불필요
+	FClassReplicationInfo CourseInfo;
+	CourseInfo.ReplicationPeriodFrame = 60;
+	CourseInfo.SetCullDistanceSquared(GridCullDistance * GridCullDistance);
+	GlobalActorReplicationInfoMap.SetClassInfo(AMovingPlatform::StaticClass(), CourseInfo);
+	GlobalActorReplicationInfoMap.SetClassInfo(ASplinePathPlatform::StaticClass(), CourseInfo);
+}
+
+void UObstacleReplicationGraph::InitGlobalGraphNodes()
+{
+	Super::InitGlobalGraphNodes();
+
+	GridNode = CreateNewNode<UReplicationGraphNode_GridSpatialization2D>();
+	GridNode->CellSize = GridCellSize;
+	GridNode->SpatialBias = FVector2D(-UE_OLD_WORLD_MAX, -UE_OLD_WORLD_MAX);
+	AddGlobalGraphNode(GridNode);
+
+	AlwaysRelevantNode = CreateNewNode<UReplicationGraphNode_ActorList>();
+	AddGlobalGraphNode(AlwaysRelevantNode);
+
+	CourseProgressNode = CreateNewNode<UReplicationGraphNode_CourseProgress>();
+	CourseProgressNode->CourseOrigin = CourseOrigin;
+	CourseProgressNode->CourseDirection = CourseDirection.GetSafeNormal();
+	CourseProgressNode->BucketLength = CourseBucketLength;
+	CourseProgressNode->NeighbourBuckets = CourseNeighbourBuckets;
+	AddGlobalGraphNode(CourseProgressNode);
+}
+
+void UObstacleReplicationGraph::InitConnectionGraphNodes(UNetReplicationGraphConnection* ConnectionManager)
+{
+	Super::InitConnectionGraphNodes(ConnectionManager);
+
+	// 커넥션 소유 액터(컨트롤러, 자기 폰 = 슬로우 RPC 컨텍스트, 뷰 타겟)는 이 노드로만 복제
+	UReplicationGraphNode_AlwaysRelevant_ForConnection* OwnerNode = CreateNewNode<UReplicationGraphNode_AlwaysRelevant_ForConnection>();
+	AddConnectionGraphNode(OwnerNode, ConnectionManager);
+}
+
+EObstacleRepRoute UObstacleReplicationGraph::GetRoute(const AActor* Actor)
+{
+	// 태그는 인스턴스 단위라 캐시하지 않음
+	if (Actor->ActorHasTag(ClimbableTag))
+	{
+		return EObstacleRepRoute::CourseDormant;
+	}
+
+	if (const EObstacleRepRoute* Route = ClassRoutes.Get(Actor->GetClass()))
+	{
+		return *Route;
+	}
+
+	// 규칙이 없는 클래스는 플래그로 판단 후 캐시
+	EObstacleRepRoute Route = EObstacleRepRoute::SpatializeDynamic;
+	if (Actor->bAlwaysRelevant)
+	{
+		Route = EObstacleRepRoute::AlwaysRelevant;
+	}
+	else if (Actor->bOnlyRelevantToOwner)
+	{
+		Route = EObstacleRepRoute::NotRouted;
+	}
+	ClassRoutes.Set(Actor->GetClass(), Route);
+	return Route;
+}
+
+void UObstacleReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
+{
+	switch (GetRoute(ActorInfo.Actor))
+	{
+	case EObstacleRepRoute::NotRouted:
+		break;
+
+	case EObstacleRepRoute::AlwaysRelevant:
+		AlwaysRelevantNode->NotifyAddNetworkActor(ActorInfo);
+		break;
+
+	case EObstacleRepRoute::Runner:
+		CourseProgressNode->NotifyAddNetworkActor(ActorInfo);
+		break;
+
+	case EObstacleRepRoute::CourseDormant:
+		// 위치가 바뀌어도 셀을 다시 계산하지 않는 정적 항목 + 초기 복제 후 휴면
+		if (ActorInfo.Actor->NetDormancy < DORM_DormantAll)
+		{
+			ActorInfo.Actor->SetNetDormancy(DORM_DormantAll);
+		}
+		GridNode->AddActor_Static(ActorInfo, GlobalInfo);
+		break;
+
+	case EObstacleRepRoute::SpatializeDynamic:
+		GridNode->AddActor_Dynamic(ActorInfo, GlobalInfo);
+		break;
+	}
+}
+
+void UObstacleReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
+{
+	switch (GetRoute(ActorInfo.Actor))
+	{
+	case EObstacleRepRoute::NotRouted:
+		break;
+
+	case EObstacleRepRoute::AlwaysRelevant:
+		AlwaysRelevantNode->NotifyRemoveNetworkActor(ActorInfo);
+		break;
+
+	case EObstacleRepRoute::Runner:
+		CourseProgressNode->NotifyRemoveNetworkActor(ActorInfo);
+		break;
+
+	case EObstacleRepRoute::CourseDormant:
+		GridNode->RemoveActor_Static(ActorInfo);
+		break;
+
+	case EObstacleRepRoute::SpatializeDynamic:
+		GridNode->RemoveActor_Dynamic(ActorInfo);
+		break;
+	}
+}
+
+int32 UObstacleReplicationGraph::ServerReplicateActors(float DeltaSeconds)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	const int32 Result = Super::ServerReplicateActors(DeltaSeconds);
+	const double Ms = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+
+	AccumulatedMs += Ms;
+	MaxMs = FMath::Max(MaxMs, Ms);
+	++AccumulatedFrames;
+
+	const double Now = FPlatformTime::Seconds();
+	if (ReportStartSeconds == 0.0)
+	{
+		ReportStartSeconds = Now;
+	}
+	else if (Now - ReportStartSeconds >= StatsReportInterval)
+	{
+		LastAverageMs = (float)(AccumulatedMs / FMath::Max(1, AccumulatedFrames));
+		LastMaxMs = (float)MaxMs;
+
+		// 16/32/64 클라이언트 비교용: 클라이언트 수와 함께 기록
+		UE_LOG(LogObstacleAssualt, Log, TEXT("RepGraph: %d clients, replication %.3f ms/frame avg, %.3f ms max over %d frames"),
+			Connections.Num(), LastAverageMs, LastMaxMs, AccumulatedFrames);
+
+		ReportStartSeconds = Now;
+		AccumulatedMs = 0.0;
+		MaxMs = 0.0;
+		AccumulatedFrames = 0;
+	}
+
+	return Result;
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+#include "ObstacleReplicationGraph.generated.h"
+
+class UReplicationGraphNode_GridSpatialization2D;
+class UReplicationGraphNode_ActorList;
+
+/** 액터를 어느 노드로 보낼지 */
+enum class EObstacleRepRoute : uint8
+{
+	/** 라우팅 안 함 (소유자 전용 → 커넥션별 노드가 처리) */
+	NotRouted,
+	/** 모든 커넥션에 항상 */
+	AlwaysRelevant,
+	/** 러너 폰 → 코스 진행도 노드 */
+	Runner,
+	/** 정적/결정적 코스 액터 → 그리드 정적 + 휴면 */
+	CourseDormant,
+	/** 그 밖의 움직이는 액터 → 그리드 동적 */
+	SpatializeDynamic,
+};
+
+/**
+ *  코스 진행도 기반 러너 관련성 노드
+ *  러너를 코스 진행 방향으로 일정 길이씩 나눈 버킷에 넣고,
+ *  뷰어가 속한 버킷과 이웃 버킷의 러너만 복제 목록에 넣는다.
+ *  러너 수가 늘어도 커넥션당 비용은 근처 러너 수에만 비례한다.
+ */
+UCLASS()
+class OBSTACLEASSUALT_API UReplicationGraphNode_CourseProgress : public UReplicationGraphNode
+{
+	GENERATED_BODY()
+
+public:
+	UReplicationGraphNode_CourseProgress();
+
+	virtual void NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo) override;
+	virtual bool NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound = true) override;
+	virtual void NotifyResetAllNetworkActors() override;
+	virtual void PrepareForReplication() override;
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+
+	/** 코스 시작점과 진행 방향 (진행도 = (위치 - 시작점) · 방향) */
+	FVector CourseOrigin = FVector::ZeroVector;
+	FVector CourseDirection = FVector::ForwardVector;
+
+	/** 버킷 하나의 진행도 길이 (cm) */
+	float BucketLength = 2000.f;
+
+	/** 뷰어 버킷 양옆으로 몇 개까지 관련 있다고 볼지 */
+	int32 NeighbourBuckets = 1;
+
+private:
+	int32 BucketIndexFor(const FVector& Location) const;
+
+	TArray<AActor*> Runners;
+	TArray<FActorRepListRefView> Buckets;
+};
+
+/**
+ *  이 게임용 복제 그래프
+ *  - 러너 폰: 코스 진행도 노드
+ *  - 발판/Climbable 벽 같은 코스 액터: 그리드 정적 + 휴면 (처음 한 번만 복제)
+ *  - 소유자 전용 상태(컨트롤러, 자기 폰의 슬로우 RPC 컨텍스트): 커넥션별 노드
+ *  - GameState/PlayerState 등: 항상 관련
+ *  oa.RepGraph.Enable 이 1이면 게임 넷 드라이버에 자동 적용된다.
+ */
+UCLASS(Transient, Config = Game)
+class OBSTACLEASSUALT_API UObstacleReplicationGraph : public UReplicationGraph
+{
+	GENERATED_BODY()
+
+public:
+	UObstacleReplicationGraph();
+
+	virtual void ResetGameWorldState() override;
+	virtual void InitGlobalActorClassSettings() override;
+	virtual void InitGlobalGraphNodes() override;
+	virtual void InitConnectionGraphNodes(UNetReplicationGraphConnection* ConnectionManager) override;
+	virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
+	virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+	virtual int32 ServerReplicateActors(float DeltaSeconds) override;
+
+	/** 서버 복제 시간 로그 간격 (초) */
+	UPROPERTY(Config)
+	float StatsReportInterval = 10.f;
+
+	UPROPERTY(Config)
+	float GridCellSize = 10000.f;
+
+	UPROPERTY(Config)
+	float GridCullDistance = 15000.f;
+
+	UPROPERTY(Config)
+	FVector CourseOrigin = FVector::ZeroVector;
+
+	UPROPERTY(Config)
+	FVector CourseDirection = FVector::ForwardVector;
+
+	UPROPERTY(Config)
+	float CourseBucketLength = 2000.f;
+
+	UPROPERTY(Config)
+	int32 CourseNeighbourBuckets = 1;
+
+	/** 마지막 보고 구간의 프레임당 평균/최대 복제 시간 (ms) */
+	float GetAverageReplicationMs() const { return LastAverageMs; }
+	float GetMaxReplicationMs() const { return LastMaxMs; }
+
+	/** 이 태그가 붙은 액터도 코스 액터로 취급 */
+	static const FName ClimbableTag;
+
+private:
+	EObstacleRepRoute GetRoute(const AActor* Actor);
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_GridSpatialization2D> GridNode;
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_ActorList> AlwaysRelevantNode;
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_CourseProgress> CourseProgressNode;
+
+	/** 클래스별로 결정된 라우팅 (상위 클래스 규칙 상속) */
+	TClassMap<EObstacleRepRoute> ClassRoutes;
+
+	double ReportStartSeconds = 0.0;
+	double AccumulatedMs = 0.0;
+	double MaxMs = 0.0;
+	int32 AccumulatedFrames = 0;
+	float LastAverageMs = 0.f;
+	float LastMaxMs = 0.f;
+};
@@ -1,24 +1,17 @@
 #include "PlaytimeWidget.h"
 #include "Components/TextBlock.h"
+#include "GameplayMath/GameplayMath.h"
 
 void UPlaytimeWidget::SetTimeSeconds(float Seconds)
 {
-    Seconds = FMath::Max(0.f, Seconds);
+    // 초 단위가 바뀔 때만 텍스트를 다시 만든다 (매 틱 호출됨)
+    const int32 Total = GameplayMath::PlaytimeWholeSeconds(Seconds);
+    if (Total == LastWholeSeconds) return;
+    LastWholeSeconds = Total;
 
-    int32 Total = FMath::FloorToInt(Seconds);
-    int32 H = Total / 3600;
-    int32 M = (Total % 3600) / 60;
-    int32 S = Total % 60;
+    // "MM:SS" 또는 "HH:MM:SS"
+    ANSICHAR Buffer[16];
+    GameplayMath::FormatPlaytime(Total, Buffer, sizeof(Buffer));
 
-    FText Out;
-    if (H > 0)
-    {
-        Out = FText::FromString(FString::Printf(TEXT("%02d:%02d:%02d"), H, M, S));
-    }
-    else
-    {
-        Out = FText::FromString(FString::Printf(TEXT("%02d:%02d"), M, S));
-    }
-
-    if (TimeText) TimeText->SetText(Out);
+    if (TimeText) TimeText->SetText(FText::FromString(ANSI_TO_TCHAR(Buffer)));
 }
\ No newline at end of file
@@ -19,4 +19,7 @@ protected:
     UPROPERTY(meta = (BindWidget))
     TObjectPtr<UTextBlock> TimeText;
 
+    /** 마지막으로 표시한 정수 초 (-1 = 아직 없음) */
+    int32 LastWholeSeconds = -1;
+
 };
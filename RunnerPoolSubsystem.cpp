@@ -0,0 +1,123 @@
+#include "RunnerPoolSubsystem.h"
+#include "ObstacleAssualtCharacter.h"
+#include "GameFramework/Controller.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "ObstacleAssualt.h"
+
+static FAutoConsoleCommandWithWorld RunnerPoolStatsCommand(
+	TEXT("oa.RunnerPool.Stats"),
+	TEXT("러너 풀 적중/실패 통계 출력"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (const URunnerPoolSubsystem* Pool = World ? World->GetSubsystem<URunnerPoolSubsystem>() : nullptr)
+		{
+			const FRunnerPoolStats Stats = Pool->GetStats();
+			const int32 Requests = Stats.Hits + Stats.Misses;
+			UE_LOG(LogObstacleAssualt, Display, TEXT("RunnerPool: hits %d, misses %d (hit rate %.1f%%), releases %d, prewarmed %d, available %d"),
+				Stats.Hits, Stats.Misses, Requests > 0 ? 100.f * Stats.Hits / Requests : 0.f, Stats.Releases, Stats.Prewarmed, Stats.Available);
+		}
+	}));
+
+bool URunnerPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+AObstacleAssualtCharacter* URunnerPoolSubsystem::SpawnRunner(UClass* RunnerClass, const FTransform& SpawnTransform, bool bForPool)
+{
+	UWorld* World = GetWorld();
+	if (!World || !RunnerClass) return nullptr;
+
+	AObstacleAssualtCharacter* Runner = World->SpawnActorDeferred<AObstacleAssualtCharacter>(
+		RunnerClass, SpawnTransform, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+	if (!Runner) return nullptr;
+
+	// BeginPlay 전에 표시해야 음악 재생 없이 바로 비활성화됨
+	Runner->bSpawnedForPool = bForPool;
+	Runner->FinishSpawning(SpawnTransform);
+	return Runner;
+}
+
+void URunnerPoolSubsystem::Prewarm(TSubclassOf<AObstacleAssualtCharacter> RunnerClass, int32 Count)
+{
+	if (!RunnerClass) return;
+
+	FRunnerPoolBucket& Bucket = Buckets.FindOrAdd(RunnerClass.Get());
+	while (Bucket.Runners.Num() < Count)
+	{
+		AObstacleAssualtCharacter* Runner = SpawnRunner(RunnerClass, FTransform::Identity, /*bForPool=*/true);
+		if (!Runner) break;
+
+		Bucket.Runners.Add(Runner);
+		++Stats.Prewarmed;
+	}
+}
+
+AObstacleAssualtCharacter* URunnerPoolSubsystem::Acquire(TSubclassOf<AObstacleAssualtCharacter> RunnerClass, const FTransform& SpawnTransform, AController* Controller)
+{
+	if (!RunnerClass) return nullptr;
+
+	AObstacleAssualtCharacter* Runner = nullptr;
+	if (FRunnerPoolBucket* Bucket = Buckets.Find(RunnerClass.Get()))
+	{
+		// 레벨 전환 등으로 파괴된 항목은 건너뜀
+		while (!Runner && Bucket->Runners.Num() > 0)
+		{
+			AObstacleAssualtCharacter* Candidate = Bucket->Runners.Pop(EAllowShrinking::No);
+			if (IsValid(Candidate))
+			{
+				Runner = Candidate;
+			}
+		}
+	}
+
+	if (Runner)
+	{
+		++Stats.Hits;
+		Runner->SetActorTransform(SpawnTransform, false, nullptr, ETeleportType::TeleportPhysics);
+		if (Controller)
+		{
+			Controller->Possess(Runner);
+			Controller->SetControlRotation(SpawnTransform.Rotator());
+		}
+		Runner->ResetForReuse();
+		return Runner;
+	}
+
+	++Stats.Misses;
+	Runner = SpawnRunner(RunnerClass, SpawnTransform, /*bForPool=*/false);
+	if (Runner && Controller)
+	{
+		Controller->Possess(Runner);
+		// BeginPlay는 빙의 전에 끝났으므로 컨트롤러 의존 부분(IMC, 위젯)을 다시 준비
+		Runner->ResetForReuse();
+	}
+	return Runner;
+}
+
+void URunnerPoolSubsystem::Release(AObstacleAssualtCharacter* Runner)
+{
+	if (!IsValid(Runner)) return;
+
+	Runner->DeactivateForPool();
+	if (AController* Controller = Runner->GetController())
+	{
+		Controller->UnPossess();
+	}
+
+	FRunnerPoolBucket& Bucket = Buckets.FindOrAdd(Runner->GetClass());
+	Bucket.Runners.AddUnique(Runner);
+	++Stats.Releases;
+}
+
+FRunnerPoolStats URunnerPoolSubsystem::GetStats() const
+{
+	FRunnerPoolStats Result = Stats;
+	Result.Available = 0;
+	for (const TPair<TObjectPtr<UClass>, FRunnerPoolBucket>& Pair : Buckets)
+	{
+		Result.Available += Pair.Value.Runners.Num();
+	}
+	return Result;
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RunnerPoolSubsystem.generated.h"
+
+class AObstacleAssualtCharacter;
+class AController;
+
+/** 풀 적중/실패 통계 */
+USTRUCT(BlueprintType)
+struct FRunnerPoolStats
+{
+	GENERATED_BODY()
+
+	/** 풀에 남아 있던 폰을 재사용한 횟수 */
+	UPROPERTY(BlueprintReadOnly, Category = "Pool")
+	int32 Hits = 0;
+
+	/** 풀이 비어 새로 스폰한 횟수 */
+	UPROPERTY(BlueprintReadOnly, Category = "Pool")
+	int32 Misses = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Pool")
+	int32 Releases = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Pool")
+	int32 Prewarmed = 0;
+
+	/** 현재 대기 중인 폰 수 (모든 클래스 합) */
+	UPROPERTY(BlueprintReadOnly, Category = "Pool")
+	int32 Available = 0;
+};
+
+USTRUCT()
+struct FRunnerPoolBucket
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<AObstacleAssualtCharacter>> Runners;
+};
+
+/**
+ *  러너 폰 풀
+ *  폰과 폰이 가진 BGM 오디오 컴포넌트 / 디새츄레이션 MID / 플레이타임 위젯을 통째로 재사용해서
+ *  봇 교체나 잦은 리스폰 때 생성·GC 스파이크가 생기지 않게 한다.
+ */
+UCLASS()
+class OBSTACLEASSUALT_API URunnerPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Count개가 대기하도록 미리 스폰 (숨김/비활성 상태) */
+	UFUNCTION(BlueprintCallable, Category = "Pool")
+	void Prewarm(TSubclassOf<AObstacleAssualtCharacter> RunnerClass, int32 Count);
+
+	/** 풀에서 꺼내 Controller가 빙의하게 한다. 풀이 비어 있으면 새로 스폰 */
+	UFUNCTION(BlueprintCallable, Category = "Pool")
+	AObstacleAssualtCharacter* Acquire(TSubclassOf<AObstacleAssualtCharacter> RunnerClass, const FTransform& SpawnTransform, AController* Controller);
+
+	/** 런이 끝난 폰을 빙의 해제하고 풀로 돌려보낸다 */
+	UFUNCTION(BlueprintCallable, Category = "Pool")
+	void Release(AObstacleAssualtCharacter* Runner);
+
+	UFUNCTION(BlueprintCallable, Category = "Pool")
+	FRunnerPoolStats GetStats() const;
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	AObstacleAssualtCharacter* SpawnRunner(UClass* RunnerClass, const FTransform& SpawnTransform, bool bForPool);
+
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UClass>, FRunnerPoolBucket> Buckets;
+
+	FRunnerPoolStats Stats;
+};
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class USplineComponent;
+
+/**
+ *  스플라인을 균일한 호장(arc-length) 간격으로 구워 둔 위치 테이블
+ *  런타임에는 거리 → 인덱스 + 선형보간만 하므로 스플라인 쿼리보다 훨씬 싸고,
+ *  구간마다 속도가 달라지는 문제(입력 키 기준 이동) 없이 등속으로 움직인다.
+ */
+struct OBSTACLEASSUALT_API FSplineArcLengthTable
+{
+	/** 월드 좌표 샘플. Points[i] = 거리 i * Spacing 지점 */
+	TArray<FVector> Points;
+
+	float Spacing = 0.f;
+	float InvSpacing = 0.f;
+	float TotalLength = 0.f;
+
+	/** 스플라인 전체를 Spacing 간격으로 샘플링 (BeginPlay에서 1회) */
+	void Bake(const USplineComponent& Spline, float InSpacing);
+
+	bool IsValid() const { return Points.Num() >= 2 && TotalLength > KINDA_SMALL_NUMBER; }
+
+	/** 거리 → 위치 (Distance는 [0, TotalLength] 범위로 클램프) */
+	FORCEINLINE FVector Sample(float Distance) const
+	{
+		const float F = FMath::Clamp(Distance, 0.f, TotalLength) * InvSpacing;
+		const int32 I = FMath::Min((int32)F, Points.Num() - 2);
+		return FMath::Lerp(Points[I], Points[I + 1], F - (float)I);
+	}
+
+	/** 거리 지점의 진행 방향 (정규화) */
+	FORCEINLINE FVector SampleDirection(float Distance) const
+	{
+		const float F = FMath::Clamp(Distance, 0.f, TotalLength) * InvSpacing;
+		const int32 I = FMath::Min((int32)F, Points.Num() - 2);
+		return (Points[I + 1] - Points[I]).GetSafeNormal();
+	}
+};
+
+/** 평가기가 프레임 사이에 유지하는 상태 */
+struct FSplinePathState
+{
+	/** 경로 진행량. 평가기에 따라 거리 또는 0~1 정규화 값 */
+	float Phase = 0.f;
+
+	/** +1 정방향, -1 역방향 (핑퐁용) */
+	float Direction = 1.f;
+};
+
+/**
+ *  경로 평가기들. 모두 같은 정적 인터페이스를 가지며 템플릿 인자로 선택되어
+ *  핫 루프 안에서는 가상 호출 없이 인라인된다.
+ *
+ *  static float Advance(FSplinePathState& State, float Speed, float DeltaTime, float Length);
+ *    → 진행 후 경로 상의 거리를 반환
+ */
+
+/** 양 끝을 왕복하는 등속 이동 (AMovingPlatform과 같은 동작) */
+struct FLinearPingPongEvaluator
+{
+	static FORCEINLINE float Advance(FSplinePathState& State, float Speed, float DeltaTime, float Length)
+	{
+		float D = State.Phase + State.Direction * Speed * DeltaTime;
+		if (D >= Length)
+		{
+			D = Length - (D - Length);
+			State.Direction = -1.f;
+		}
+		else if (D <= 0.f)
+		{
+			D = -D;
+			State.Direction = 1.f;
+		}
+		State.Phase = FMath::Clamp(D, 0.f, Length);
+		return State.Phase;
+	}
+};
+
+/** 닫힌 스플라인을 한 방향으로 계속 도는 이동 */
+struct FLoopedSplineEvaluator
+{
+	static FORCEINLINE float Advance(FSplinePathState& State, float Speed, float DeltaTime, float Length)
+	{
+		State.Phase = FMath::Fmod(State.Phase + Speed * DeltaTime, Length);
+		if (State.Phase < 0.f)
+		{
+			State.Phase += Length;
+		}
+		return State.Phase;
+	}
+};
+
+/** 양 끝에서 감속/가속하는 왕복 이동 (평균 속도는 Speed와 같음) */
+struct FEasedSplineEvaluator
+{
+	static FORCEINLINE float Advance(FSplinePathState& State, float Speed, float DeltaTime, float Length)
+	{
+		// Phase는 0~1 정규화 진행도
+		float T = State.Phase + State.Direction * (Speed / Length) * DeltaTime;
+		if (T >= 1.f)
+		{
+			T = 2.f - T;
+			State.Direction = -1.f;
+		}
+		else if (T <= 0.f)
+		{
+			T = -T;
+			State.Direction = 1.f;
+		}
+		State.Phase = FMath::Clamp(T, 0.f, 1.f);
+
+		// smoothstep
+		const float Eased = State.Phase * State.Phase * (3.f - 2.f * State.Phase);
+		return Eased * Length;
+	}
+};
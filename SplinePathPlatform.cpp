@@ -0,0 +1,288 @@
+#include "SplinePathPlatform.h"
+#include "CourseInitSchedulerSubsystem.h"
+#include "GCReportSubsystem.h"
+#include "Components/SceneComponent.h"
+#include "Components/SplineComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "HitchRecorder.h"
+#include "ObstacleAssualt.h"
+
+void FSplineArcLengthTable::Bake(const USplineComponent& Spline, float InSpacing)
+{
+	TotalLength = Spline.GetSplineLength();
+	Spacing = FMath::Max(1.f, InSpacing);
+
+	const int32 NumSegments = FMath::Max(1, FMath::CeilToInt(TotalLength / Spacing));
+	// 마지막 샘플이 정확히 끝점에 오도록 간격을 살짝 조정
+	Spacing = TotalLength > 0.f ? TotalLength / NumSegments : Spacing;
+	InvSpacing = Spacing > 0.f ? 1.f / Spacing : 0.f;
+
+	Points.SetNumUninitialized(NumSegments + 1);
+	for (int32 i = 0; i <= NumSegments; ++i)
+	{
+		Points[i] = Spline.GetLocationAtDistanceAlongSpline(i * Spacing, ESplineCoordinateSpace::World);
+	}
+}
+
+ASplinePathPlatform::ASplinePathPlatform()
+{
+	PrimaryActorTick.bCanEverTick = true;
+
+	PathRoot = CreateDefaultSubobject<USceneComponent>(TEXT("PathRoot"));
+	RootComponent = PathRoot;
+
+	PathSpline = CreateDefaultSubobject<USplineComponent>(TEXT("PathSpline"));
+	PathSpline->SetupAttachment(PathRoot);
+
+	// 발판만 움직이고 스플라인은 월드에 고정
+	PlatformMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("PlatformMesh"));
+	PlatformMesh->SetupAttachment(PathRoot);
+	PlatformMesh->SetMobility(EComponentMobility::Movable);
+
+	bCanBeInCluster = true;
+}
+
+bool ASplinePathPlatform::CanBeInCluster() const
+{
+	return UGCReportSubsystem::ShouldClusterCourseContent() && Super::CanBeInCluster();
+}
+
+// 평가기로 Seconds 만큼 한 번에 진행. 주기로 나눈 나머지만, 반사가 한 번 이하가 되도록 편도 단위로 나눠 진행
+template <typename TEvaluator>
+static void AdvancePathStateBy(FSplinePathState& State, float Speed, double Seconds, float Length, bool bPingPong)
+{
+	if (Speed <= 0.f || Length <= KINDA_SMALL_NUMBER || Seconds <= 0.0) return;
+
+	const double OneWay = Length / Speed;
+	double Remaining = FMath::Fmod(Seconds, bPingPong ? 2.0 * OneWay : OneWay);
+	while (Remaining > 0.0)
+	{
+		const double Step = FMath::Min(Remaining, OneWay);
+		TEvaluator::Advance(State, Speed, (float)Step, Length);
+		Remaining -= Step;
+	}
+}
+
+void ASplinePathPlatform::BeginPlay()
+{
+	Super::BeginPlay();
+
+	HitchRecorder = UHitchRecorderSubsystem::Get(this);
+	PhaseTimeSeconds = GetWorld()->GetTimeSeconds();
+
+	// 굽기는 스케줄러가 프레임 예산 안에서 (가까운 발판 먼저). 그 전까지는 제자리에서 대기
+	if (UCourseInitSchedulerSubsystem* Scheduler = UCourseInitSchedulerSubsystem::Get(this))
+	{
+		SetActorTickEnabled(false);
+		Scheduler->Schedule(this, [this]() { InitializePlatform(); });
+	}
+	else
+	{
+		InitializePlatform();
+	}
+}
+
+void ASplinePathPlatform::InitializePlatform()
+{
+	if (bPlatformInitialized) return;
+	bPlatformInitialized = true;
+
+	ArcLengthTable.Bake(*PathSpline, BakeSpacing);
+
+	if (!ArcLengthTable.IsValid())
+	{
+		UE_LOG(LogObstacleAssualt, Warning, TEXT("%s: spline path is empty, platform will not move"), *GetName());
+		SetActorTickEnabled(false);
+		return;
+	}
+
+	// 처음부터 돌던 것처럼 대기한 시간만큼 진행한 위치/회전에서 시작
+	const double Now = GetWorld()->GetTimeSeconds();
+	PathState = ComputeCatchUpState(Now, ArcLengthTable.TotalLength);
+	bHasPendingPathState = false;
+
+	const double Elapsed = FMath::Max(0.0, Now - PhaseTimeSeconds);
+	if (!bOrientToPath && !RotationVelocity.IsZero() && Elapsed > 0.0)
+	{
+		PlatformMesh->AddLocalRotation(RotationVelocity * Elapsed);
+	}
+
+	ApplyPathState();
+	SetActorTickEnabled(true);
+}
+
+FSplinePathState ASplinePathPlatform::ComputeCatchUpState(double Now, float Length) const
+{
+	FSplinePathState State = PathState;
+	if (!bHasPendingPathState)
+	{
+		// EasedPingPong은 정규화 진행도, 나머지는 거리로 Phase를 사용
+		State.Phase = MotionType == ESplinePathMotion::EasedPingPong ? StartOffset : StartOffset * Length;
+		State.Direction = 1.f;
+	}
+
+	const double Elapsed = Now - PhaseTimeSeconds;
+	switch (MotionType)
+	{
+	case ESplinePathMotion::LinearPingPong:
+		AdvancePathStateBy<FLinearPingPongEvaluator>(State, Speed, Elapsed, Length, true);
+		break;
+	case ESplinePathMotion::Loop:
+		AdvancePathStateBy<FLoopedSplineEvaluator>(State, Speed, Elapsed, Length, false);
+		break;
+	case ESplinePathMotion::EasedPingPong:
+		AdvancePathStateBy<FEasedSplineEvaluator>(State, Speed, Elapsed, Length, true);
+		break;
+	}
+	return State;
+}
+
+FSplinePathState ASplinePathPlatform::GetPathState() const
+{
+	if (!bPlatformInitialized)
+	{
+		// 아직 대기 중이면 테이블 없이 스플라인 길이로 지금 시점 상태를 계산
+		return ComputeCatchUpState(GetWorld()->GetTimeSeconds(), PathSpline->GetSplineLength());
+	}
+	return PathState;
+}
+
+void ASplinePathPlatform::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	FHitchScope HitchScope(HitchRecorder, EHitchScope::PlatformTick);
+	if (HitchRecorder) HitchRecorder->NotePlatformUpdated();
+
+	// 분기는 프레임당 한 번, 실제 이동 코드는 평가기별로 인라인된 인스턴스
+	switch (MotionType)
+	{
+	case ESplinePathMotion::LinearPingPong:
+		AdvancePath<FLinearPingPongEvaluator>(DeltaTime);
+		break;
+	case ESplinePathMotion::Loop:
+		AdvancePath<FLoopedSplineEvaluator>(DeltaTime);
+		break;
+	case ESplinePathMotion::EasedPingPong:
+		AdvancePath<FEasedSplineEvaluator>(DeltaTime);
+		break;
+	}
+}
+
+void ASplinePathPlatform::RestorePathState(const FSplinePathState& State)
+{
+	PathState = State;
+
+	if (!bPlatformInitialized)
+	{
+		// 초기화 때 이 상태에서부터 따라잡음
+		bHasPendingPathState = true;
+		PhaseTimeSeconds = GetWorld()->GetTimeSeconds();
+		return;
+	}
+
+	ApplyPathState();
+}
+
+void ASplinePathPlatform::ApplyPathState()
+{
+	if (!ArcLengthTable.IsValid()) return;
+
+	// 0초 진행으로 현재 상태의 위치를 다시 적용
+	switch (MotionType)
+	{
+	case ESplinePathMotion::LinearPingPong:
+		AdvancePath<FLinearPingPongEvaluator>(0.f);
+		break;
+	case ESplinePathMotion::Loop:
+		AdvancePath<FLoopedSplineEvaluator>(0.f);
+		break;
+	case ESplinePathMotion::EasedPingPong:
+		AdvancePath<FEasedSplineEvaluator>(0.f);
+		break;
+	}
+}
+
+template <typename TEvaluator>
+void ASplinePathPlatform::AdvancePath(float DeltaTime)
+{
+	const float Distance = TEvaluator::Advance(PathState, Speed, DeltaTime, ArcLengthTable.TotalLength);
+	const FVector NewLocation = ArcLengthTable.Sample(Distance);
+
+	if (bOrientToPath)
+	{
+		const FVector Dir = ArcLengthTable.SampleDirection(Distance) * PathState.Direction;
+		PlatformMesh->SetWorldLocationAndRotation(NewLocation, FRotator(0.f, Dir.Rotation().Yaw, 0.f));
+	}
+	else
+	{
+		PlatformMesh->SetWorldLocation(NewLocation);
+		if (!RotationVelocity.IsZero())
+		{
+			PlatformMesh->AddLocalRotation(RotationVelocity * DeltaTime);
+		}
+	}
+}
+
+// 구운 테이블 조회 vs USplineComponent 직접 조회 비용 비교
+// 사용법: oa.SplinePath.Bench [Samples]
+static FAutoConsoleCommandWithWorldAndArgs SplinePathBenchCommand(
+	TEXT("oa.SplinePath.Bench"),
+	TEXT("첫 번째 ASplinePathPlatform으로 호장 테이블과 스플라인 직접 조회 비용을 비교"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World) return;
+
+		ASplinePathPlatform* Platform = nullptr;
+		for (TActorIterator<ASplinePathPlatform> It(World); It; ++It)
+		{
+			if (It->GetArcLengthTable().IsValid())
+			{
+				Platform = *It;
+				break;
+			}
+		}
+		if (!Platform)
+		{
+			UE_LOG(LogObstacleAssualt, Warning, TEXT("oa.SplinePath.Bench: no spline path platform with a baked table"));
+			return;
+		}
+
+		const int32 NumSamples = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 100000;
+		const FSplineArcLengthTable& Table = Platform->GetArcLengthTable();
+		const USplineComponent* Spline = Platform->GetPathSpline();
+
+		// 두 쪽 모두 같은 거리 시퀀스를 사용
+		TArray<float> Distances;
+		Distances.SetNumUninitialized(NumSamples);
+		FRandomStream Rand(1234);
+		for (float& D : Distances)
+		{
+			D = Rand.FRandRange(0.f, Table.TotalLength);
+		}
+
+		FVector Sink = FVector::ZeroVector;
+
+		const double TableStart = FPlatformTime::Seconds();
+		for (float D : Distances)
+		{
+			Sink += Table.Sample(D);
+		}
+		const double TableSeconds = FPlatformTime::Seconds() - TableStart;
+
+		const double SplineStart = FPlatformTime::Seconds();
+		for (float D : Distances)
+		{
+			Sink += Spline->GetLocationAtDistanceAlongSpline(D, ESplineCoordinateSpace::World);
+		}
+		const double SplineSeconds = FPlatformTime::Seconds() - SplineStart;
+
+		UE_LOG(LogObstacleAssualt, Display, TEXT("oa.SplinePath.Bench: %d samples, %d table points | table %.1f ns/sample | spline %.1f ns/sample | x%.1f (sink %.1f)"),
+			NumSamples, Table.Points.Num(),
+			TableSeconds * 1e9 / NumSamples,
+			SplineSeconds * 1e9 / NumSamples,
+			TableSeconds > 0.0 ? SplineSeconds / TableSeconds : 0.0,
+			Sink.X);
+	}));
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "SplinePathEvaluators.h"
+#include "SplinePathPlatform.generated.h"
+
+class USceneComponent;
+class USplineComponent;
+class UStaticMeshComponent;
+class UHitchRecorderSubsystem;
+
+UENUM(BlueprintType)
+enum class ESplinePathMotion : uint8
+{
+	/** 스플라인 양 끝 왕복 */
+	LinearPingPong,
+	/** 한 방향으로 계속 순환 (닫힌 스플라인 권장) */
+	Loop,
+	/** 양 끝에서 감속하는 왕복 */
+	EasedPingPong,
+};
+
+/**
+ *  스플라인 경로를 따라 움직이는 발판
+ *  초기화(UCourseInitSchedulerSubsystem 예약)에서 스플라인을 호장 테이블로 구워 두고, 틱에서는 테이블만 조회한다.
+ *  액터/스플라인은 제자리에 두고 PlatformMesh 컴포넌트만 이동시킨다.
+ */
+UCLASS()
+class OBSTACLEASSUALT_API ASplinePathPlatform : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	ASplinePathPlatform();
+
+protected:
+	virtual void BeginPlay() override;
+
+public:
+	virtual void Tick(float DeltaTime) override;
+
+	/** AMovingPlatform 과 같이 레벨 GC 클러스터에 넣는다 */
+	virtual bool CanBeInCluster() const override;
+
+	/** 구워진 테이블 (벤치마크/디버그용) */
+	const FSplineArcLengthTable& GetArcLengthTable() const { return ArcLengthTable; }
+
+	USplineComponent* GetPathSpline() const { return PathSpline; }
+
+	/** 체크포인트용 경로 진행 상태 (초기화 대기 중이면 지금 시점까지 진행한 값) */
+	FSplinePathState GetPathState() const;
+	void RestorePathState(const FSplinePathState& State);
+
+	/** 테이블 굽기 + 대기한 시간만큼 경로 진행 후 틱 시작 */
+	void InitializePlatform();
+
+	UPROPERTY(EditAnywhere, Category = "Path")
+	ESplinePathMotion MotionType = ESplinePathMotion::LinearPingPong;
+
+	/** 경로 상의 이동 속도 (cm/s). EasedPingPong에서는 평균 속도 */
+	UPROPERTY(EditAnywhere, Category = "Path", meta = (ClampMin = "0.0"))
+	float Speed = 200.f;
+
+	/** 시작 위치 (경로 길이에 대한 0~1 비율) */
+	UPROPERTY(EditAnywhere, Category = "Path", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float StartOffset = 0.f;
+
+	/** 진행 방향으로 발판을 회전시킬지 */
+	UPROPERTY(EditAnywhere, Category = "Path")
+	bool bOrientToPath = false;
+
+	/** 호장 테이블 샘플 간격 (cm). 작을수록 곡선이 정확하고 메모리가 늘어남 */
+	UPROPERTY(EditAnywhere, Category = "Path|Bake", meta = (ClampMin = "1.0"))
+	float BakeSpacing = 10.f;
+
+	UPROPERTY(EditAnywhere)
+	FRotator RotationVelocity = FRotator::ZeroRotator;
+
+private:
+	/** 평가기 타입별로 인스턴스화되는 이동 루프 */
+	template <typename TEvaluator>
+	void AdvancePath(float DeltaTime);
+
+	/** 현재 PathState 위치를 0초 진행으로 다시 적용 */
+	void ApplyPathState();
+
+	/** 초기화 전 상태(시작 위치 또는 복원된 상태)에서 Now 까지 진행한 상태 */
+	FSplinePathState ComputeCatchUpState(double Now, float Length) const;
+
+	UPROPERTY(VisibleAnywhere, Category = "Components")
+	TObjectPtr<USceneComponent> PathRoot;
+
+	UPROPERTY(VisibleAnywhere, Category = "Components")
+	TObjectPtr<USplineComponent> PathSpline;
+
+	UPROPERTY(VisibleAnywhere, Category = "Components")
+	TObjectPtr<UStaticMeshComponent> PlatformMesh;
+
+	/** 클러스터 멤버이므로 월드와 수명이 같은 오브젝트만 참조 */
+	UPROPERTY(Transient)
+	TObjectPtr<UHitchRecorderSubsystem> HitchRecorder;
+
+	FSplineArcLengthTable ArcLengthTable;
+	FSplinePathState PathState;
+
+	/** 초기화 대기 중 PathState 가 유효한 월드 시각 */
+	double PhaseTimeSeconds = 0.0;
+
+	/** 초기화 전에 RestorePathState 로 상태가 들어왔는지 (아니면 StartOffset 에서 시작) */
+	bool bHasPendingPathState = false;
+
+	bool bPlatformInitialized = false;
+};
@@ -0,0 +1,443 @@
+#include "StreamingBGM.h"
+#include "Engine/World.h"
+#include "HAL/Event.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/Paths.h"
+#include "ObstacleAssualt.h"
+#include "UObject/UObjectIterator.h"
+
+static TAutoConsoleVariable<float> CVarBGMChunkSeconds(
+	TEXT("oa.BGM.ChunkSeconds"),
+	0.5f,
+	TEXT("BGM 스트리밍 청크 길이 (초, 스트림을 열 때 적용)"));
+
+static TAutoConsoleVariable<int32> CVarBGMChunks(
+	TEXT("oa.BGM.Chunks"),
+	4,
+	TEXT("BGM 프리페치 캐시 슬롯 수 (스트림을 열 때 적용). 상주 메모리 = 슬롯 수 × 청크 크기"));
+
+static TAutoConsoleVariable<float> CVarBGMRateSmoothing(
+	TEXT("oa.BGM.RateSmoothing"),
+	0.15f,
+	TEXT("재생 속도가 목표(타임 딜레이션)를 따라가는 시간 상수 (초, 0이면 즉시)"));
+
+static FAutoConsoleCommandWithWorld BGMStatsCommand(
+	TEXT("oa.BGM.Stats"),
+	TEXT("스트리밍 BGM 상주 메모리, 캐시 적중, 오디오 스레드 비용 출력"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		for (TObjectIterator<UStreamingBGMSound> It; It; ++It)
+		{
+			if (It->GetWorld() == World)
+			{
+				UE_LOG(LogObstacleAssualt, Display, TEXT("%s"), *It->DescribeStats());
+			}
+		}
+	}));
+
+// ------------------------------------------------------------
+// FStreamingBGMCache
+// ------------------------------------------------------------
+
+FStreamingBGMCache::FStreamingBGMCache(const FString& InPath, float InChunkSeconds, int32 InNumChunks)
+	: Path(InPath)
+	, ChunkSeconds(FMath::Max(0.05f, InChunkSeconds))
+	, NumChunks(FMath::Max(2, InNumChunks))
+{
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(/*bIsManualReset=*/false);
+}
+
+FStreamingBGMCache::~FStreamingBGMCache()
+{
+	FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+	WakeEvent = nullptr;
+	File.Reset();
+}
+
+bool FStreamingBGMCache::Open()
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	File.Reset(PlatformFile.OpenRead(*Path));
+	if (!File)
+	{
+		UE_LOG(LogObstacleAssualt, Warning, TEXT("StreamingBGM: failed to open %s"), *Path);
+		return false;
+	}
+
+	uint8 Riff[12];
+	if (!File->Read(Riff, sizeof(Riff)) || FMemory::Memcmp(Riff, "RIFF", 4) != 0 || FMemory::Memcmp(Riff + 8, "WAVE", 4) != 0)
+	{
+		UE_LOG(LogObstacleAssualt, Warning, TEXT("StreamingBGM: %s is not a WAV file"), *Path);
+		return false;
+	}
+
+	// fmt / data 청크만 보고 나머지(LIST 등)는 건너뜀
+	uint16 Format = 0;
+	uint16 Bits = 0;
+	while (DataBytes == 0)
+	{
+		uint8 Header[8];
+		if (!File->Read(Header, sizeof(Header))) break;
+
+		uint32 Size = 0;
+		FMemory::Memcpy(&Size, Header + 4, 4);
+		const int64 BodyStart = File->Tell();
+
+		if (FMemory::Memcmp(Header, "fmt ", 4) == 0 && Size >= 16)
+		{
+			uint8 Fmt[16];
+			if (!File->Read(Fmt, sizeof(Fmt))) break;
+
+			uint16 Channels = 0;
+			uint32 Rate = 0;
+			FMemory::Memcpy(&Format, Fmt + 0, 2);
+			FMemory::Memcpy(&Channels, Fmt + 2, 2);
+			FMemory::Memcpy(&Rate, Fmt + 4, 4);
+			FMemory::Memcpy(&Bits, Fmt + 14, 2);
+			NumChannels = Channels;
+			SampleRate = (int32)Rate;
+		}
+		else if (FMemory::Memcmp(Header, "data", 4) == 0)
+		{
+			DataOffset = BodyStart;
+			DataBytes = FMath::Min<int64>(Size, File->Size() - BodyStart);
+		}
+
+		// RIFF 청크는 짝수 바이트 정렬
+		File->Seek(BodyStart + Size + (Size & 1));
+	}
+
+	const int32 FrameBytes = NumChannels * (int32)sizeof(int16);
+	if (Format != 1 || Bits != 16 || NumChannels < 1 || NumChannels > 2 || SampleRate <= 0 || DataBytes < FrameBytes)
+	{
+		UE_LOG(LogObstacleAssualt, Warning, TEXT("StreamingBGM: %s must be 16-bit PCM mono/stereo (format %d, %d bits, %d channels)"),
+			*Path, Format, Bits, NumChannels);
+		return false;
+	}
+	DataBytes -= DataBytes % FrameBytes;
+
+	ChunkFrames = FMath::Max(1024, FMath::RoundToInt(SampleRate * ChunkSeconds));
+	Ring.SetNum(NumChunks);
+	for (FStreamingBGMChunk& Chunk : Ring)
+	{
+		Chunk.Samples.SetNumZeroed(ChunkFrames * NumChannels);
+	}
+	return true;
+}
+
+bool FStreamingBGMCache::Init()
+{
+	// FRunnableThread::Create 는 Init 이 끝날 때까지 기다리므로 뒤이은 Stop 과 겹치지 않음
+	bStopRequested = false;
+	return true;
+}
+
+uint32 FStreamingBGMCache::Run()
+{
+	while (!bStopRequested.load(std::memory_order_relaxed))
+	{
+		const uint32 Written = WriteCount.load(std::memory_order_relaxed);
+		const uint32 Consumed = ReadCount.load(std::memory_order_acquire);
+		if (Written - Consumed >= (uint32)Ring.Num())
+		{
+			// 캐시가 가득 참. 오디오 스레드가 청크를 돌려주면 깨어남
+			WakeEvent->Wait(20);
+			continue;
+		}
+
+		const uint32 Generation = RequestedGeneration.load(std::memory_order_acquire);
+		if (Generation != FillGeneration)
+		{
+			FillGeneration = Generation;
+			ReadCursor = 0;
+		}
+
+		FillChunk(Ring[Written % Ring.Num()], Generation);
+		WriteCount.store(Written + 1, std::memory_order_release);
+	}
+	return 0;
+}
+
+void FStreamingBGMCache::Stop()
+{
+	bStopRequested = true;
+	WakeEvent->Trigger();
+}
+
+void FStreamingBGMCache::FillChunk(FStreamingBGMChunk& Chunk, uint32 Generation)
+{
+	uint8* Dest = (uint8*)Chunk.Samples.GetData();
+	int64 Remaining = (int64)ChunkFrames * NumChannels * sizeof(int16);
+
+	// 트랙 끝을 넘으면 처음부터 이어서 (루프)
+	while (Remaining > 0)
+	{
+		const int64 ToRead = FMath::Min(Remaining, DataBytes - ReadCursor);
+		if (!File->Seek(DataOffset + ReadCursor) || !File->Read(Dest, ToRead))
+		{
+			ReadFailures.Increment();
+			FMemory::Memzero(Dest, Remaining);
+			break;
+		}
+
+		Dest += ToRead;
+		Remaining -= ToRead;
+		ReadCursor += ToRead;
+		if (ReadCursor >= DataBytes)
+		{
+			ReadCursor = 0;
+		}
+	}
+
+	Chunk.NumFrames = ChunkFrames;
+	Chunk.Generation = Generation;
+	ChunksRead.Increment();
+}
+
+const FStreamingBGMChunk* FStreamingBGMCache::PeekReady(uint32 Offset) const
+{
+	const uint32 Consumed = ReadCount.load(std::memory_order_relaxed);
+	const uint32 Written = WriteCount.load(std::memory_order_acquire);
+	return Written - Consumed > Offset ? &Ring[(Consumed + Offset) % Ring.Num()] : nullptr;
+}
+
+void FStreamingBGMCache::ReleaseFront()
+{
+	ReadCount.store(ReadCount.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	WakeEvent->Trigger();
+}
+
+void FStreamingBGMCache::Rewind()
+{
+	RequestedGeneration.fetch_add(1, std::memory_order_release);
+	WakeEvent->Trigger();
+}
+
+double FStreamingBGMCache::GetTrackSeconds() const
+{
+	return SampleRate > 0 && NumChannels > 0 ? (double)DataBytes / ((double)SampleRate * NumChannels * sizeof(int16)) : 0.0;
+}
+
+int64 FStreamingBGMCache::GetResidentBytes() const
+{
+	return (int64)Ring.Num() * ChunkFrames * NumChannels * sizeof(int16);
+}
+
+// ------------------------------------------------------------
+// UStreamingBGMSound
+// ------------------------------------------------------------
+
+UStreamingBGMSound::UStreamingBGMSound(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	Duration = INDEFINITELY_LOOPING_DURATION;
+	SoundGroup = SOUNDGROUP_Music;
+}
+
+bool UStreamingBGMSound::OpenStream(const FString& InPath)
+{
+	SuspendStream();
+
+	StreamPath = FPaths::IsRelative(InPath) ? FPaths::Combine(FPaths::ProjectContentDir(), InPath) : InPath;
+	Cache = MakeUnique<FStreamingBGMCache>(StreamPath, CVarBGMChunkSeconds.GetValueOnGameThread(), CVarBGMChunks.GetValueOnGameThread());
+	if (!Cache->Open())
+	{
+		Cache.Reset();
+		return false;
+	}
+
+	NumChannels = Cache->GetNumChannels();
+	SetSampleRate(Cache->GetSampleRate());
+
+	if (!StartReaderThread())
+	{
+		Cache.Reset();
+		return false;
+	}
+
+	UE_LOG(LogObstacleAssualt, Log, TEXT("StreamingBGM: %s (%.1f s, %d ch @ %d Hz), resident %.1f KB"),
+		*StreamPath, Cache->GetTrackSeconds(), NumChannels, Cache->GetSampleRate(), Cache->GetResidentBytes() / 1024.0);
+	return true;
+}
+
+bool UStreamingBGMSound::StartReaderThread()
+{
+	ReaderThread = FRunnableThread::Create(Cache.Get(), TEXT("OAStreamingBGM"), 0, TPri_AboveNormal);
+	return ReaderThread != nullptr;
+}
+
+void UStreamingBGMSound::SuspendStream()
+{
+	if (ReaderThread)
+	{
+		Cache->Stop();
+		ReaderThread->WaitForCompletion();
+		delete ReaderThread;
+		ReaderThread = nullptr;
+	}
+}
+
+bool UStreamingBGMSound::ResumeStream()
+{
+	if (!Cache) return false;
+	if (ReaderThread) return true;
+
+	Cache->Rewind();
+	return StartReaderThread();
+}
+
+void UStreamingBGMSound::BeginDestroy()
+{
+	// 캐시 메모리는 오디오 스레드가 마지막 버퍼를 만들 수 있으므로 소멸 때까지 유지
+	SuspendStream();
+	Super::BeginDestroy();
+}
+
+void UStreamingBGMSound::SetTargetRate(float Rate)
+{
+	Rate = FMath::Clamp(Rate, 0.01f, 4.f);
+	if (FMath::IsNearlyEqual(Rate, LastTargetRate, 1e-3f)) return;
+
+	LastTargetRate = Rate;
+	++RateUpdates;
+	TargetRate.store(Rate, std::memory_order_relaxed);
+}
+
+void UStreamingBGMSound::Rewind()
+{
+	if (Cache) Cache->Rewind();
+}
+
+int32 UStreamingBGMSound::OnGeneratePCMAudio(TArray<uint8>& OutAudio, int32 NumSamples)
+{
+	if (!Cache || NumChannels <= 0) return 0;
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	const int32 Channels = NumChannels;
+	const int32 NumFrames = NumSamples / Channels;
+	OutAudio.SetNumUninitialized(NumFrames * Channels * sizeof(int16), EAllowShrinking::No);
+	int16* Out = (int16*)OutAudio.GetData();
+
+	// 버퍼 하나 동안 목표 속도로 지수적으로 다가가고, 버퍼 안에서는 선형으로 이어 붙인다
+	const float Target = TargetRate.load(std::memory_order_relaxed);
+	const float StartRate = CurrentRate;
+	float EndRate = Target;
+	const float Smoothing = CVarBGMRateSmoothing.GetValueOnAnyThread();
+	if (Smoothing > 0.f)
+	{
+		const float Alpha = 1.f - FMath::Exp(-(float)NumFrames / (Cache->GetSampleRate() * Smoothing));
+		EndRate = StartRate + (Target - StartRate) * Alpha;
+		if (FMath::IsNearlyEqual(EndRate, Target, 1e-3f))
+		{
+			EndRate = Target;
+		}
+	}
+	CurrentRate = EndRate;
+	const bool bRamping = StartRate != EndRate;
+	const float RateStep = NumFrames > 0 ? (EndRate - StartRate) / NumFrames : 0.f;
+
+	const uint32 Generation = Cache->GetGeneration();
+	if (Generation != PlayingGeneration)
+	{
+		PlayingGeneration = Generation;
+		Position = 0.0;
+	}
+
+	int32 Frame = 0;
+	while (Frame < NumFrames)
+	{
+		// 되감기 전에 채워진 청크는 버림
+		const FStreamingBGMChunk* Front = Cache->PeekReady(0);
+		while (Front && Front->Generation != Generation)
+		{
+			Cache->ReleaseFront();
+			Front = Cache->PeekReady(0);
+		}
+		if (!Front) break;
+
+		// 청크 경계의 보간에는 다음 청크 첫 프레임을 씀 (아직 없으면 마지막 프레임 유지)
+		const FStreamingBGMChunk* Next = Cache->PeekReady(1);
+		const int16* NextFirst = Next && Next->Generation == Generation ? Next->Samples.GetData() : nullptr;
+
+		const int16* Samples = Front->Samples.GetData();
+		const int32 FrontFrames = Front->NumFrames;
+		while (Frame < NumFrames && Position < FrontFrames)
+		{
+			const int32 Index = (int32)Position;
+			const float Alpha = (float)(Position - Index);
+			const int16* A = Samples + Index * Channels;
+			const int16* B = Index + 1 < FrontFrames ? A + Channels : (NextFirst ? NextFirst : A);
+
+			for (int32 Ch = 0; Ch < Channels; ++Ch)
+			{
+				Out[Frame * Channels + Ch] = (int16)FMath::RoundToInt(A[Ch] + (B[Ch] - A[Ch]) * Alpha);
+			}
+
+			Position += StartRate + RateStep * Frame;
+			++Frame;
+		}
+
+		if (Position >= FrontFrames)
+		{
+			Position -= FrontFrames;
+			Cache->ReleaseFront();
+		}
+	}
+
+	if (Frame < NumFrames)
+	{
+		// 캐시가 비었으면 나머지는 무음
+		Underruns.fetch_add(1, std::memory_order_relaxed);
+		FMemory::Memzero(Out + Frame * Channels, (NumFrames - Frame) * Channels * sizeof(int16));
+	}
+
+	const uint64 Cycles = FPlatformTime::Cycles64() - StartCycles;
+	if (bRamping)
+	{
+		RampCycles.fetch_add(Cycles, std::memory_order_relaxed);
+		RampBuffers.fetch_add(1, std::memory_order_relaxed);
+	}
+	else
+	{
+		SteadyCycles.fetch_add(Cycles, std::memory_order_relaxed);
+		SteadyBuffers.fetch_add(1, std::memory_order_relaxed);
+	}
+	if (Cycles > MaxBufferCycles.load(std::memory_order_relaxed))
+	{
+		MaxBufferCycles.store(Cycles, std::memory_order_relaxed);
+	}
+
+	return NumFrames * Channels;
+}
+
+void UStreamingBGMSound::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(Cache ? Cache->GetResidentBytes() : 0);
+}
+
+FString UStreamingBGMSound::DescribeStats() const
+{
+	if (!Cache)
+	{
+		return FString::Printf(TEXT("StreamingBGM %s: not open"), *GetName());
+	}
+
+	const uint32 NumSteady = SteadyBuffers.load(std::memory_order_relaxed);
+	const uint32 NumRamp = RampBuffers.load(std::memory_order_relaxed);
+	const double SteadyUs = NumSteady > 0 ? FPlatformTime::ToMilliseconds64(SteadyCycles.load(std::memory_order_relaxed)) * 1000.0 / NumSteady : 0.0;
+	const double RampUs = NumRamp > 0 ? FPlatformTime::ToMilliseconds64(RampCycles.load(std::memory_order_relaxed)) * 1000.0 / NumRamp : 0.0;
+	const double WorstUs = FPlatformTime::ToMilliseconds64(MaxBufferCycles.load(std::memory_order_relaxed)) * 1000.0;
+
+	// 비교용: 같은 트랙을 PCM으로 통째로 올렸을 때 크기
+	const double FullyLoadedMB = Cache->GetTrackSeconds() * Cache->GetSampleRate() * NumChannels * sizeof(int16) / (1024.0 * 1024.0);
+
+	return FString::Printf(TEXT("StreamingBGM %s: %.1f s track | resident %.1f KB (fully loaded PCM %.1f MB) | chunks read %d, read failures %d, underruns %u | rate %.2f, %d rate updates | audio thread: steady %.1f us/buffer (%u), slow-mo ramp %.1f us/buffer (%u), worst %.1f us"),
+		*FPaths::GetCleanFilename(StreamPath), Cache->GetTrackSeconds(),
+		Cache->GetResidentBytes() / 1024.0, FullyLoadedMB,
+		Cache->GetChunksRead(), Cache->GetReadFailures(), Underruns.load(std::memory_order_relaxed),
+		LastTargetRate, RateUpdates,
+		SteadyUs, NumSteady, RampUs, NumRamp, WorstUs);
+}
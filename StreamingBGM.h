@@ -0,0 +1,159 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Sound/SoundWaveProcedural.h"
+#include <atomic>
+#include "StreamingBGM.generated.h"
+
+class FEvent;
+class FRunnableThread;
+class IFileHandle;
+
+/** 캐시 슬롯 하나 (인터리브된 16비트 PCM) */
+struct FStreamingBGMChunk
+{
+	TArray<int16> Samples;
+	int32 NumFrames = 0;
+
+	/** 채울 때의 되감기 세대. 오디오 스레드는 지난 세대 청크를 재생하지 않고 버린다 */
+	uint32 Generation = 0;
+};
+
+/**
+ *  BGM 청크 프리페치 캐시
+ *  읽기 스레드가 16비트 PCM WAV 의 data 구간을 청크 단위로 읽어 고정 개수의 슬롯(링)을 채우고,
+ *  오디오 렌더 스레드가 앞에서부터 소비한다. 생산자/소비자가 하나씩이라 카운터 두 개로만 동기화하고,
+ *  트랙 길이와 상관없이 상주 메모리는 슬롯 수 × 청크 크기로 고정된다. 트랙 끝에서는 처음으로 이어 읽는다.
+ */
+class FStreamingBGMCache : public FRunnable
+{
+public:
+	FStreamingBGMCache(const FString& InPath, float ChunkSeconds, int32 NumChunks);
+	virtual ~FStreamingBGMCache() override;
+
+	/** 헤더를 읽고 슬롯을 할당 (게임 스레드, 스레드 시작 전) */
+	bool Open();
+
+	/** 새 읽기 스레드에서 Run 전에 호출 (멈췄던 캐시를 다시 돌릴 때 정지 요청 해제) */
+	virtual bool Init() override;
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+	/** 오디오 스레드 전용. Offset 번째로 준비된 청크 (0 = 맨 앞), 아직 없으면 nullptr */
+	const FStreamingBGMChunk* PeekReady(uint32 Offset) const;
+
+	/** 오디오 스레드 전용. 맨 앞 청크를 다 썼으니 읽기 스레드에 돌려준다 */
+	void ReleaseFront();
+
+	/** 처음부터 다시 (아무 스레드). 이미 채워진 청크는 오디오 스레드가 세대를 보고 버린다 */
+	void Rewind();
+	uint32 GetGeneration() const { return RequestedGeneration.load(); }
+
+	int32 GetSampleRate() const { return SampleRate; }
+	int32 GetNumChannels() const { return NumChannels; }
+	double GetTrackSeconds() const;
+
+	/** 슬롯 메모리 (상주 PCM 전부) */
+	int64 GetResidentBytes() const;
+
+	int32 GetChunksRead() const { return ChunksRead.GetValue(); }
+	int32 GetReadFailures() const { return ReadFailures.GetValue(); }
+
+private:
+	void FillChunk(FStreamingBGMChunk& Chunk, uint32 Generation);
+
+	FString Path;
+	float ChunkSeconds;
+	int32 NumChunks;
+
+	int32 SampleRate = 0;
+	int32 NumChannels = 0;
+	int32 ChunkFrames = 0;
+
+	/** 아래는 읽기 스레드 전용 */
+	TUniquePtr<IFileHandle> File;
+	int64 DataOffset = 0;
+	int64 DataBytes = 0;
+	int64 ReadCursor = 0;
+	uint32 FillGeneration = 0;
+
+	TArray<FStreamingBGMChunk> Ring;
+
+	/** 채운/소비한 청크 누적 수. 차이가 준비된 청크 수 */
+	std::atomic<uint32> WriteCount { 0 };
+	std::atomic<uint32> ReadCount { 0 };
+	std::atomic<uint32> RequestedGeneration { 0 };
+
+	FEvent* WakeEvent = nullptr;
+	FThreadSafeCounter ChunksRead;
+	FThreadSafeCounter ReadFailures;
+	std::atomic<bool> bStopRequested { false };
+};
+
+/**
+ *  디스크에서 청크로 스트리밍하는 BGM
+ *  재생 속도는 게임 스레드가 원자 변수 하나로 넘기고(SetTargetRate, 바뀔 때만),
+ *  오디오 스레드가 버퍼마다 목표로 부드럽게 따라가며 선형 보간 리샘플링한다 (피치도 함께 변함).
+ *  오디오 컴포넌트 파라미터는 건드리지 않는다. 통계: oa.BGM.Stats
+ */
+UCLASS()
+class OBSTACLEASSUALT_API UStreamingBGMSound : public USoundWaveProcedural
+{
+	GENERATED_BODY()
+
+public:
+	UStreamingBGMSound(const FObjectInitializer& ObjectInitializer);
+
+	/** 16비트 PCM WAV 를 열고 읽기 스레드 시작 (상대 경로면 Content 기준) */
+	bool OpenStream(const FString& InPath);
+
+	/** 게임 스레드. 값이 바뀐 경우에만 오디오 스레드에 보인다 */
+	void SetTargetRate(float Rate);
+
+	/** 다음 재생을 트랙 처음부터 */
+	void Rewind();
+
+	/**
+	 *  읽기 스레드만 멈춤 (풀 대기, 원격 러너가 된 폰). 캐시 슬롯은 오디오 스레드가
+	 *  마지막 버퍼를 만들 수 있으므로 소멸 때까지 유지하고, 그 사이 재생은 무음(언더런)
+	 */
+	void SuspendStream();
+
+	/** SuspendStream 뒤 같은 캐시로 읽기 스레드 재시작 (처음부터) */
+	bool ResumeStream();
+
+	bool IsStreamActive() const { return ReaderThread != nullptr; }
+
+	FString DescribeStats() const;
+
+	virtual int32 OnGeneratePCMAudio(TArray<uint8>& OutAudio, int32 NumSamples) override;
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+	virtual void BeginDestroy() override;
+
+private:
+	bool StartReaderThread();
+
+	FString StreamPath;
+	TUniquePtr<FStreamingBGMCache> Cache;
+	FRunnableThread* ReaderThread = nullptr;
+
+	/** 게임 → 오디오 스레드 */
+	std::atomic<float> TargetRate { 1.f };
+	float LastTargetRate = 1.f;
+	int32 RateUpdates = 0;
+
+	/** 아래는 오디오 스레드 전용 */
+	float CurrentRate = 1.f;
+	double Position = 0.0;
+	uint32 PlayingGeneration = 0;
+
+	/** 오디오 스레드 비용 (속도 변화 중인 버퍼와 일정한 버퍼를 따로) */
+	std::atomic<uint64> SteadyCycles { 0 };
+	std::atomic<uint64> RampCycles { 0 };
+	std::atomic<uint64> MaxBufferCycles { 0 };
+	std::atomic<uint32> SteadyBuffers { 0 };
+	std::atomic<uint32> RampBuffers { 0 };
+	std::atomic<uint32> Underruns { 0 };
+};
@@ -0,0 +1,347 @@
+#include "TelemetrySubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/RunnableThread.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/Compression.h"
+#include "Misc/Crc.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+#include "ObstacleAssualt.h"
+
+static TAutoConsoleVariable<int32> CVarTelemetryEnable(
+	TEXT("oa.Telemetry.Enable"),
+	1,
+	TEXT("게임플레이 텔레메트리 기록 (월드 시작 시 적용)"));
+
+static TAutoConsoleVariable<float> CVarTelemetrySampleHz(
+	TEXT("oa.Telemetry.SampleHz"),
+	10.f,
+	TEXT("러너 위치 샘플 주기 (실시간 기준 Hz, 0 = 샘플 안 함)"));
+
+static TAutoConsoleVariable<int32> CVarTelemetryMaxFileMB(
+	TEXT("oa.Telemetry.MaxFileMB"),
+	16,
+	TEXT("이 크기를 넘으면 다음 파일로 교체 (월드 시작 시 적용)"));
+
+static FAutoConsoleCommandWithWorldAndArgs TelemetryBenchCommand(
+	TEXT("oa.Telemetry.Bench"),
+	TEXT("텔레메트리 기록 1회의 게임 스레드 비용 측정: oa.Telemetry.Bench [Events]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UTelemetrySubsystem* Telemetry = UTelemetrySubsystem::Get(World);
+		const APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+		const APawn* Runner = PC ? PC->GetPawn() : nullptr;
+		if (!Telemetry || !Runner)
+		{
+			UE_LOG(LogObstacleAssualt, Warning, TEXT("Telemetry bench: telemetry disabled or no local pawn"));
+			return;
+		}
+
+		// 실제로 기록되는 경로(ShouldRecord 통과)를 재야 하므로 로컬 조종 중인 러너여야 함
+		if (!UTelemetrySubsystem::ShouldRecord(Runner))
+		{
+			UE_LOG(LogObstacleAssualt, Warning, TEXT("Telemetry bench: %s is not a recorded runner (not locally controlled or pooled)"), *Runner->GetName());
+			return;
+		}
+
+		const int32 NumEvents = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 10000;
+		const double Ns = Telemetry->MeasureRecordNs(Runner, NumEvents);
+
+		UE_LOG(LogObstacleAssualt, Display, TEXT("Telemetry bench: Record %.1f ns/event with %d registered runners (budget 100 ns) -> %s, dropped so far %d"),
+			Ns, Telemetry->GetNumRunners(), Ns < 100.0 ? TEXT("PASS") : TEXT("FAIL"), Telemetry->GetDroppedCount());
+	}));
+
+namespace Telemetry
+{
+	static const uint32 FileMagic = 0x4C54414F; // 'OATL'
+	static const uint32 FileVersion = 2;
+
+	/** 큐 용량 (10Hz 샘플 기준 수 초 분량의 여유) */
+	static const uint32 QueueCapacity = 1 << 14;
+
+	/** 한 압축 블록의 최대 이벤트 수 / 최대 대기 시간 */
+	static const int32 BlockEvents = 4096;
+	static const double BlockSeconds = 1.0;
+}
+
+// ------------------------------------------------------------
+// FTelemetryWriter
+// ------------------------------------------------------------
+
+FTelemetryWriter::FTelemetryWriter(const FString& InCourseName, int64 InMaxFileBytes)
+	: Queue(Telemetry::QueueCapacity)
+	, CourseName(InCourseName)
+	, MaxFileBytes(InMaxFileBytes)
+	, SessionTicks(FDateTime::UtcNow().GetTicks())
+{
+	BasePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Telemetry"),
+		FString::Printf(TEXT("%s_%s"), *CourseName, *FDateTime::Now().ToString()));
+	Pending.Reserve(Telemetry::BlockEvents);
+}
+
+FTelemetryWriter::~FTelemetryWriter()
+{
+	File.Reset();
+}
+
+uint32 FTelemetryWriter::Run()
+{
+	LastFlushSeconds = FPlatformTime::Seconds();
+
+	while (!bStopRequested)
+	{
+		Drain();
+		if (Pending.Num() > 0 && FPlatformTime::Seconds() - LastFlushSeconds >= Telemetry::BlockSeconds)
+		{
+			FlushBlock();
+		}
+		FPlatformProcess::Sleep(0.01f);
+	}
+
+	// 종료 시 남은 이벤트까지 기록
+	Drain();
+	FlushBlock();
+	return 0;
+}
+
+void FTelemetryWriter::Drain()
+{
+	FTelemetryEvent Event;
+	while (Queue.Dequeue(Event))
+	{
+		Pending.Add(Event);
+		if (Pending.Num() >= Telemetry::BlockEvents)
+		{
+			FlushBlock();
+		}
+	}
+}
+
+bool FTelemetryWriter::OpenNextFile()
+{
+	File.Reset();
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	const FString Path = FString::Printf(TEXT("%s_%03d.oatl"), *BasePath, FileIndex++);
+	PlatformFile.CreateDirectoryTree(*FPaths::GetPath(Path));
+
+	File.Reset(PlatformFile.OpenWrite(*Path));
+	if (!File)
+	{
+		UE_LOG(LogObstacleAssualt, Warning, TEXT("Telemetry: failed to open %s"), *Path);
+		return false;
+	}
+
+	// 헤더: magic, version, 이벤트 크기, 코스 이름, 파일 시작 시각, 세션 시작 시각 (UTC ticks)
+	TArray<uint8> Header;
+	auto Append = [&Header](const void* Data, int32 Size) { Header.Append((const uint8*)Data, Size); };
+
+	const uint32 Magic = Telemetry::FileMagic;
+	const uint32 Version = Telemetry::FileVersion;
+	const uint32 EventSize = sizeof(FTelemetryEvent);
+	Append(&Magic, 4);
+	Append(&Version, 4);
+	Append(&EventSize, 4);
+
+	FTCHARToUTF8 NameUtf8(*CourseName);
+	const uint8 NameLen = (uint8)FMath::Min(NameUtf8.Length(), 255);
+	Append(&NameLen, 1);
+	Append(NameUtf8.Get(), NameLen);
+
+	const int64 StartTicks = FDateTime::UtcNow().GetTicks();
+	Append(&StartTicks, 8);
+	Append(&SessionTicks, 8);
+
+	File->Write(Header.GetData(), Header.Num());
+	FileBytes = Header.Num();
+	FilesOpened.Increment();
+	return true;
+}
+
+void FTelemetryWriter::FlushBlock()
+{
+	LastFlushSeconds = FPlatformTime::Seconds();
+	if (Pending.Num() == 0) return;
+
+	if ((!File || FileBytes >= MaxFileBytes) && !OpenNextFile())
+	{
+		Pending.Reset();
+		return;
+	}
+
+	const int32 RawSize = Pending.Num() * sizeof(FTelemetryEvent);
+	int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, RawSize);
+	Compressed.SetNumUninitialized(CompressedSize, EAllowShrinking::No);
+
+	if (!FCompression::CompressMemory(NAME_Zlib, Compressed.GetData(), CompressedSize, Pending.GetData(), RawSize))
+	{
+		UE_LOG(LogObstacleAssualt, Warning, TEXT("Telemetry: compression failed, dropping %d events"), Pending.Num());
+		Pending.Reset();
+		return;
+	}
+
+	// 블록: 원본 크기, 압축 크기, 압축 데이터
+	const uint32 Sizes[2] = { (uint32)RawSize, (uint32)CompressedSize };
+	File->Write((const uint8*)Sizes, sizeof(Sizes));
+	File->Write(Compressed.GetData(), CompressedSize);
+	File->Flush();
+
+	FileBytes += sizeof(Sizes) + CompressedSize;
+	BlocksWritten.Increment();
+	Pending.Reset();
+}
+
+// ------------------------------------------------------------
+// UTelemetrySubsystem
+// ------------------------------------------------------------
+
+UTelemetrySubsystem* UTelemetrySubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	UTelemetrySubsystem* Telemetry = World ? World->GetSubsystem<UTelemetrySubsystem>() : nullptr;
+	return Telemetry && Telemetry->Writer ? Telemetry : nullptr;
+}
+
+bool UTelemetrySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UTelemetrySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (CVarTelemetryEnable.GetValueOnGameThread() == 0) return;
+
+	const FString CourseName = UGameplayStatics::GetCurrentLevelName(GetWorld(), /*bRemovePrefixString=*/true);
+	const int64 MaxFileBytes = (int64)FMath::Max(1, CVarTelemetryMaxFileMB.GetValueOnGameThread()) * 1024 * 1024;
+
+	Writer = MakeUnique<FTelemetryWriter>(CourseName, MaxFileBytes);
+	WriterThread = FRunnableThread::Create(Writer.Get(), TEXT("OATelemetryWriter"), 0, TPri_BelowNormal);
+	if (!WriterThread)
+	{
+		Writer.Reset();
+		return;
+	}
+
+	TickStartHandle = FWorldDelegates::OnWorldTickStart.AddUObject(this, &UTelemetrySubsystem::OnWorldTickStart);
+}
+
+void UTelemetrySubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldTickStart.Remove(TickStartHandle);
+
+	if (WriterThread)
+	{
+		Writer->Stop();
+		WriterThread->WaitForCompletion();
+		delete WriterThread;
+		WriterThread = nullptr;
+
+		UE_LOG(LogObstacleAssualt, Log, TEXT("Telemetry: %d blocks in %d files, %d events dropped"),
+			Writer->GetBlocksWritten(), Writer->GetFilesOpened(), Dropped);
+	}
+	Writer.Reset();
+	Runners.Reset();
+
+	Super::Deinitialize();
+}
+
+double UTelemetrySubsystem::MeasureRecordNs(const APawn* Runner, int32 NumEvents)
+{
+	// 큐가 넘치면 드롭 경로를 재게 되므로 큐 용량 안에서
+	NumEvents = FMath::Clamp(NumEvents, 1, (int32)Telemetry::QueueCapacity - 1);
+
+	// 기록 스레드는 원래 기록기를 계속 붙잡고 있으므로 포인터만 바꿔 끼워도 안전.
+	// 임시 기록기는 스레드 없이 버려지므로 파일을 열지 않는다
+	TUniquePtr<FTelemetryWriter> LiveWriter = MoveTemp(Writer);
+	Writer = MakeUnique<FTelemetryWriter>(TEXT("Bench"), 0);
+	const int32 LiveDropped = Dropped;
+
+	const uint64 Start = FPlatformTime::Cycles64();
+	for (int32 i = 0; i < NumEvents; ++i)
+	{
+		Record(ETelemetryEvent::Position, Runner, (float)i);
+	}
+	const double Ns = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - Start) * 1e6 / NumEvents;
+
+	Writer = MoveTemp(LiveWriter);
+	Dropped = LiveDropped;
+	return Ns;
+}
+
+bool UTelemetrySubsystem::ShouldRecord(const APawn* Runner)
+{
+	return Runner->IsLocallyControlled() && !Runner->IsHidden();
+}
+
+uint32 UTelemetrySubsystem::MakeRunnerId(const APlayerState* PlayerState)
+{
+	if (!PlayerState) return 0;
+
+	const FUniqueNetIdRepl& NetId = PlayerState->GetUniqueId();
+	const FString Key = NetId.IsValid() ? NetId.ToString() : PlayerState->GetPlayerName();
+	return FCrc::StrCrc32(*Key);
+}
+
+uint32 UTelemetrySubsystem::GetRunnerId(const APawn* Runner)
+{
+	const APlayerState* PlayerState = Runner->GetPlayerState();
+	for (FRunnerEntry& Entry : Runners)
+	{
+		if (Entry.Runner.Get() != Runner) continue;
+
+		if (Entry.PlayerState.Get() != PlayerState)
+		{
+			Entry.PlayerState = PlayerState;
+			Entry.Id = MakeRunnerId(PlayerState);
+		}
+		return Entry.Id;
+	}
+	return MakeRunnerId(PlayerState);
+}
+
+void UTelemetrySubsystem::RegisterRunner(ACharacter* Runner)
+{
+	if (!Runners.ContainsByPredicate([Runner](const FRunnerEntry& Entry) { return Entry.Runner.Get() == Runner; }))
+	{
+		Runners.Add({ Runner });
+	}
+}
+
+void UTelemetrySubsystem::UnregisterRunner(ACharacter* Runner)
+{
+	Runners.RemoveAllSwap([Runner](const FRunnerEntry& Entry) { return Entry.Runner.Get() == Runner; });
+}
+
+void UTelemetrySubsystem::OnWorldTickStart(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds)
+{
+	if (InWorld != GetWorld()) return;
+
+	// 이번 프레임 이벤트의 타임스탬프
+	FrameGameSeconds = InWorld->GetTimeSeconds();
+	FrameRealSeconds = InWorld->GetRealTimeSeconds();
+
+	// 위치 샘플은 슬로우와 무관하게 실시간 기준 고정 주기
+	const float SampleHz = CVarTelemetrySampleHz.GetValueOnGameThread();
+	if (SampleHz <= 0.f || FrameRealSeconds < NextSampleRealSeconds) return;
+	NextSampleRealSeconds = FrameRealSeconds + 1.f / SampleHz;
+
+	for (int32 i = Runners.Num() - 1; i >= 0; --i)
+	{
+		const ACharacter* Runner = Runners[i].Runner.Get();
+		if (!Runner)
+		{
+			Runners.RemoveAtSwap(i);
+			continue;
+		}
+
+		// 이벤트와 같은 필터 (Record 안의 ShouldRecord)
+		Record(ETelemetryEvent::Position, Runner, (float)Runner->GetVelocity().Size());
+	}
+}
@@ -0,0 +1,208 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/CircularQueue.h"
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TelemetrySubsystem.generated.h"
+
+class FRunnableThread;
+class IFileHandle;
+class ACharacter;
+class APawn;
+class APlayerState;
+
+/** 텔레메트리 이벤트 종류 (파일 포맷에 그대로 기록되므로 순서 유지) */
+enum class ETelemetryEvent : uint8
+{
+	Position,
+	ClimbStart,
+	ClimbCommit,
+	ClimbFinish,
+	AutoClimbReject,
+	Hang,
+	Drop,
+	SlowMoOn,
+	SlowMoOff,
+	Fall,
+
+	Count
+};
+
+/** AutoClimbReject 이벤트의 Detail 값 */
+enum class ETelemetryClimbReject : uint8
+{
+	Approach,
+	ImpactSpeed,
+	NoLedge,
+};
+
+/** 큐/파일에 그대로 들어가는 고정 크기 이벤트 (32바이트) */
+struct FTelemetryEvent
+{
+	float GameSeconds;
+	float RealSeconds;
+
+	/** 플레이어 기준 ID (UTelemetrySubsystem::MakeRunnerId). 세션/폰이 바뀌어도 같은 플레이어면 같은 값 */
+	uint32 RunnerId;
+	FVector3f Location;
+	float Value;
+	uint8 Type;
+	uint8 Detail;
+	uint16 Reserved;
+};
+static_assert(sizeof(FTelemetryEvent) == 32, "FTelemetryEvent is part of the .oatl file format");
+
+/**
+ *  백그라운드 기록 스레드
+ *  게임 스레드(단일 생산자)가 넣은 이벤트를 모아 블록 단위로 Zlib 압축해
+ *  파일에 쓰고, 파일이 커지면 다음 파일로 넘어간다.
+ */
+class FTelemetryWriter : public FRunnable
+{
+public:
+	FTelemetryWriter(const FString& InCourseName, int64 InMaxFileBytes);
+	virtual ~FTelemetryWriter() override;
+
+	virtual uint32 Run() override;
+	virtual void Stop() override { bStopRequested = true; }
+
+	/** 게임 스레드 전용. 큐가 가득 차면 버리고 false */
+	FORCEINLINE bool Enqueue(const FTelemetryEvent& Event) { return Queue.Enqueue(Event); }
+
+	/** 기록한 블록/파일 수 (통계용, 아무 스레드) */
+	int32 GetBlocksWritten() const { return BlocksWritten.GetValue(); }
+	int32 GetFilesOpened() const { return FilesOpened.GetValue(); }
+
+private:
+	void Drain();
+	void FlushBlock();
+	bool OpenNextFile();
+
+	TCircularQueue<FTelemetryEvent> Queue;
+
+	/** 아래는 기록 스레드 전용 */
+	TArray<FTelemetryEvent> Pending;
+	TArray<uint8> Compressed;
+	TUniquePtr<IFileHandle> File;
+	int64 FileBytes = 0;
+	int32 FileIndex = 0;
+	double LastFlushSeconds = 0.0;
+
+	FString CourseName;
+	FString BasePath;
+	int64 MaxFileBytes;
+
+	/** 세션 시작 시각 (UTC ticks). 교체된 파일 모두 같은 값이라 분석 도구가 세션을 구분하는 키 */
+	int64 SessionTicks = 0;
+
+	FThreadSafeCounter BlocksWritten;
+	FThreadSafeCounter FilesOpened;
+	TAtomic<bool> bStopRequested { false };
+};
+
+/**
+ *  게임플레이 텔레메트리
+ *  등반/슬로우/낙하 같은 이벤트와 일정 주기의 위치 샘플을 바이너리로 모아
+ *  Saved/Telemetry 의 .oatl 파일에 기록한다. 게임 스레드 비용은 이벤트 하나를
+ *  잠금 없는 큐에 복사하는 것뿐이다 (oa.Telemetry.Bench 로 확인).
+ *  분석: Tools/telemetry_heatmap.py
+ */
+UCLASS()
+class OBSTACLEASSUALT_API UTelemetrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** 월드에서 텔레메트리를 찾는다 (없거나 꺼져 있으면 nullptr) */
+	static UTelemetrySubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 *  이벤트 하나 기록 (게임 스레드 전용)
+	 *  위치 샘플과 같은 러너만 기록한다 (ShouldRecord). 서버/다른 클라이언트의 프록시에서 같은 이벤트가
+	 *  중복으로 남지 않고, 한 파일에는 그 프로세스가 조종한 러너의 이벤트와 샘플만 들어간다.
+	 */
+	FORCEINLINE void Record(ETelemetryEvent Type, const APawn* Runner, float Value = 0.f, uint8 Detail = 0)
+	{
+		if (!ShouldRecord(Runner)) return;
+
+		if (!Writer->Enqueue(MakeEvent(Type, Runner, GetRunnerId(Runner), Value, Detail)))
+		{
+			++Dropped;
+		}
+	}
+
+	FORCEINLINE FTelemetryEvent MakeEvent(ETelemetryEvent Type, const AActor* Runner, uint32 RunnerId, float Value, uint8 Detail) const
+	{
+		FTelemetryEvent Event;
+		Event.GameSeconds = FrameGameSeconds;
+		Event.RealSeconds = FrameRealSeconds;
+		Event.RunnerId = RunnerId;
+		Event.Location = FVector3f(Runner->GetActorLocation());
+		Event.Value = Value;
+		Event.Type = (uint8)Type;
+		Event.Detail = Detail;
+		Event.Reserved = 0;
+		return Event;
+	}
+
+	/** 이 프로세스가 조종하는 러너만 (원격 프록시 제외), 풀 대기 폰 제외 */
+	static bool ShouldRecord(const APawn* Runner);
+
+	/**
+	 *  플레이어의 고유 넷 ID (없으면 플레이어 이름) 의 CRC. 파일을 합쳐 분석할 때
+	 *  세션이나 풀 폰이 달라도 같은 플레이어를 같은 러너로 본다. PlayerState 가 아직 없으면 0
+	 */
+	static uint32 MakeRunnerId(const APlayerState* PlayerState);
+
+	/** 위치 샘플 대상 등록 */
+	void RegisterRunner(ACharacter* Runner);
+	void UnregisterRunner(ACharacter* Runner);
+
+	int32 GetDroppedCount() const { return Dropped; }
+	int32 GetNumRunners() const { return Runners.Num(); }
+
+	/**
+	 *  oa.Telemetry.Bench 전용. 기록 스레드가 없는 임시 기록기로 바꿔 끼우고 Record 를 NumEvents 번 호출한
+	 *  이벤트당 평균 시간 (ns). 실제 파일과 드롭 수는 건드리지 않는다
+	 */
+	double MeasureRecordNs(const APawn* Runner, int32 NumEvents);
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	void OnWorldTickStart(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds);
+
+	/** 등록된 러너면 PlayerState 가 바뀔 때만 다시 계산한 캐시 값 */
+	uint32 GetRunnerId(const APawn* Runner);
+
+	TUniquePtr<FTelemetryWriter> Writer;
+	FRunnableThread* WriterThread = nullptr;
+
+	struct FRunnerEntry
+	{
+		TWeakObjectPtr<ACharacter> Runner;
+
+		/** Id 를 계산할 때의 PlayerState (풀 폰 재빙의, 클라이언트의 늦은 복제) */
+		TWeakObjectPtr<const APlayerState> PlayerState;
+		uint32 Id = 0;
+	};
+	TArray<FRunnerEntry> Runners;
+
+	/** 이벤트 타임스탬프 (프레임마다 한 번 갱신) */
+	float FrameGameSeconds = 0.f;
+	float FrameRealSeconds = 0.f;
+	float NextSampleRealSeconds = 0.f;
+
+	int32 Dropped = 0;
+
+	FDelegateHandle TickStartHandle;
+};
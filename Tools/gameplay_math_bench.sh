@@ -0,0 +1,43 @@
+#!/usr/bin/env bash
+# Compare GameplayMath microbenchmarks between the working tree and another commit.
+#
+# Usage:
+#   Tools/gameplay_math_bench.sh [BaseRef=HEAD~1] [Tolerance=0.25]
+#
+# Both trees are built and run on this machine back to back, so the numbers
+# are comparable even though absolute ns/op differ between machines.
+# Exits 1 when any kernel is slower than the base by more than Tolerance.
+
+set -euo pipefail
+
+BASE_REF="${1:-HEAD~1}"
+TOLERANCE="${2:-0.25}"
+
+ROOT="$(git rev-parse --show-toplevel)"
+WORK="${BENCH_DIR:-$ROOT/_bench}"
+mkdir -p "$WORK"
+
+build() {
+    cmake -S "$1/GameplayMath" -B "$2" -DCMAKE_BUILD_TYPE=Release >/dev/null
+    cmake --build "$2" --target GameplayMathBench -j"$(nproc)" >/dev/null
+}
+
+cleanup() {
+    git -C "$ROOT" worktree remove --force "$WORK/base-src" 2>/dev/null || true
+}
+trap cleanup EXIT
+
+cleanup
+git -C "$ROOT" worktree add --detach "$WORK/base-src" "$BASE_REF" >/dev/null
+if [ ! -f "$WORK/base-src/GameplayMath/CMakeLists.txt" ]; then
+    echo "$BASE_REF has no GameplayMath library; nothing to compare" >&2
+    exit 2
+fi
+
+build "$WORK/base-src" "$WORK/base"
+build "$ROOT" "$WORK/current"
+
+echo "base: $(git -C "$ROOT" rev-parse --short "$BASE_REF")"
+"$WORK/base/GameplayMathBench" --json "$WORK/base.json" >/dev/null
+"$WORK/current/GameplayMathBench" --json "$WORK/current.json" \
+    --baseline "$WORK/base.json" --tolerance "$TOLERANCE"
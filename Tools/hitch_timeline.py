@@ -0,0 +1,151 @@
+"""Convert HitchRecorder dumps (*.oahr) into a Chrome trace timeline.
+
+Usage:
+    python hitch_timeline.py Saved/Profiling/Hitches/Hitch_xxx.oahr [-o out.json]
+
+Open the resulting JSON in chrome://tracing or https://ui.perfetto.dev.
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+MAGIC = 0x5248414F  # 'OAHR'
+SUPPORTED_VERSION = 1
+
+CLIMB_EVENTS = [
+    (1 << 0, "AutoClimb"),
+    (1 << 1, "ClimbStart"),
+    (1 << 2, "ClimbCommit"),
+    (1 << 3, "ClimbFinish"),
+    (1 << 4, "Drop"),
+]
+
+
+def read_dump(path):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    offset = 0
+
+    def take(fmt):
+        nonlocal offset
+        values = struct.unpack_from("<" + fmt, data, offset)
+        offset += struct.calcsize("<" + fmt)
+        return values
+
+    magic, version, num_scopes, num_records, threshold_ms = take("IIIIf")
+    if magic != MAGIC:
+        raise ValueError("%s is not a hitch dump" % path)
+    if version != SUPPORTED_VERSION:
+        raise ValueError("unsupported dump version %d" % version)
+
+    scope_names = []
+    for _ in range(num_scopes):
+        (length,) = take("B")
+        scope_names.append(data[offset:offset + length].decode("utf-8"))
+        offset += length
+
+    (reason_len,) = take("B")
+    reason = data[offset:offset + reason_len].decode("utf-8")
+    offset += reason_len
+
+    record_fmt = "Qdf" + "f" * num_scopes + "fHBB"
+    records = []
+    for _ in range(num_records):
+        values = take(record_fmt)
+        records.append({
+            "frame": values[0],
+            "start": values[1],
+            "frame_ms": values[2],
+            "scopes": list(values[3:3 + num_scopes]),
+            "dilation": values[3 + num_scopes],
+            "platforms": values[4 + num_scopes],
+            "slowmo": bool(values[5 + num_scopes]),
+            "climb": values[6 + num_scopes],
+        })
+
+    return {
+        "threshold_ms": threshold_ms,
+        "scope_names": scope_names,
+        "reason": reason,
+        "records": records,
+    }
+
+
+def to_trace(dump):
+    events = []
+    records = dump["records"]
+    if not records:
+        return {"traceEvents": events}
+
+    base = records[0]["start"]
+    threshold = dump["threshold_ms"]
+
+    for rec in records:
+        ts = (rec["start"] - base) * 1e6
+        name = "Frame %d" % rec["frame"]
+        if rec["frame_ms"] > threshold:
+            name += " (HITCH)"
+        events.append({
+            "name": name, "ph": "X", "ts": ts, "dur": rec["frame_ms"] * 1000.0,
+            "pid": 1, "tid": 1,
+            "args": {"frame_ms": rec["frame_ms"], "platforms": rec["platforms"]},
+        })
+
+        # 스코프는 프레임 안에서 순서 정보가 없으므로 누적 시간으로 나란히 배치
+        cursor = ts
+        for name, ms in zip(dump["scope_names"], rec["scopes"]):
+            if ms <= 0.0:
+                continue
+            events.append({
+                "name": name, "ph": "X", "ts": cursor, "dur": ms * 1000.0,
+                "pid": 1, "tid": 2,
+            })
+            cursor += ms * 1000.0
+
+        events.append({"name": "TimeDilation", "ph": "C", "ts": ts, "pid": 1,
+                       "args": {"dilation": rec["dilation"], "slowmo": int(rec["slowmo"])}})
+        events.append({"name": "PlatformsUpdated", "ph": "C", "ts": ts, "pid": 1,
+                       "args": {"count": rec["platforms"]}})
+
+        for bit, label in CLIMB_EVENTS:
+            if rec["climb"] & bit:
+                events.append({"name": label, "ph": "i", "s": "t", "ts": ts, "pid": 1, "tid": 3})
+
+    events.append({"name": "thread_name", "ph": "M", "pid": 1, "tid": 1, "args": {"name": "Frames"}})
+    events.append({"name": "thread_name", "ph": "M", "pid": 1, "tid": 2, "args": {"name": "Gameplay scopes"}})
+    events.append({"name": "thread_name", "ph": "M", "pid": 1, "tid": 3, "args": {"name": "Climb events"}})
+
+    return {"traceEvents": events, "otherData": {"reason": dump["reason"], "threshold_ms": threshold}}
+
+
+def print_summary(dump):
+    records = dump["records"]
+    hitches = [r for r in records if r["frame_ms"] > dump["threshold_ms"]]
+    print("%s: %d frames, %d over %.1f ms" % (dump["reason"], len(records), len(hitches), dump["threshold_ms"]))
+    for rec in hitches:
+        scopes = ", ".join("%s %.2f" % (n, ms) for n, ms in zip(dump["scope_names"], rec["scopes"]))
+        print("  frame %d: %.2f ms [%s] dilation %.2f platforms %d" % (
+            rec["frame"], rec["frame_ms"], scopes, rec["dilation"], rec["platforms"]))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("dump")
+    parser.add_argument("-o", "--output", help="output JSON path (default: <dump>.json)")
+    args = parser.parse_args()
+
+    dump = read_dump(args.dump)
+    print_summary(dump)
+
+    output = args.output or args.dump + ".json"
+    with open(output, "w") as f:
+        json.dump(to_trace(dump), f)
+    print("wrote %s" % output)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
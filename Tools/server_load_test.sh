@@ -0,0 +1,61 @@
+#!/usr/bin/env bash
+# Local multi-process load test: one dedicated server + N headless clients.
+#
+# Usage:
+#   UE_EDITOR=/path/to/UnrealEditor UPROJECT=/path/to/ObstacleAssualt.uproject \
+#     Tools/server_load_test.sh [NumClients] [DurationSeconds] [Map]
+#
+# The server records a CSV profile (Saved/Profiling/CSV) for roughly the
+# test duration (-csvCaptureFrames at SERVER_TICK_RATE, default 30 Hz).
+# Per-runner server CPU = mean GameThread frame time / NumClients. Run once
+# on the old build and once on the new one and compare the two CSV files.
+#
+# With the replication graph enabled (oa.RepGraph.Enable, default 1) the
+# server log also gets a "RepGraph:" line with per-frame replication time:
+#   for n in 16 32 64; do Tools/server_load_test.sh "$n" 120; done
+
+set -euo pipefail
+
+NUM_CLIENTS="${1:-16}"
+DURATION="${2:-120}"
+MAP="${3:-/Game/ThirdPerson/Lvl_ThirdPerson}"
+PORT="${PORT:-7777}"
+
+: "${UE_EDITOR:?set UE_EDITOR to the UnrealEditor binary}"
+: "${UPROJECT:?set UPROJECT to the .uproject path}"
+
+LOG_DIR="${LOG_DIR:-$(dirname "$UPROJECT")/Saved/LoadTest/$(date +%Y%m%d_%H%M%S)}"
+mkdir -p "$LOG_DIR"
+
+pids=()
+cleanup() {
+    for pid in "${pids[@]}"; do
+        kill "$pid" 2>/dev/null || true
+    done
+    wait 2>/dev/null || true
+}
+trap cleanup EXIT
+
+echo "server: $MAP on port $PORT, $NUM_CLIENTS clients, ${DURATION}s -> $LOG_DIR"
+
+"$UE_EDITOR" "$UPROJECT" "$MAP?listen" -server -log -unattended -nosound \
+    -port="$PORT" -csvCaptureFrames=$((DURATION * ${SERVER_TICK_RATE:-30})) \
+    -abslog="$LOG_DIR/server.log" >/dev/null 2>&1 &
+pids+=($!)
+
+# wait for the server to open the port
+sleep "${SERVER_WARMUP:-20}"
+
+for ((i = 0; i < NUM_CLIENTS; ++i)); do
+    "$UE_EDITOR" "$UPROJECT" "127.0.0.1:$PORT" -game -nullrhi -nosound -unattended \
+        -windowed -resx=320 -resy=240 \
+        -abslog="$LOG_DIR/client_$i.log" >/dev/null 2>&1 &
+    pids+=($!)
+done
+
+sleep "$DURATION"
+
+echo "replication time ($NUM_CLIENTS clients):"
+grep "RepGraph:" "$LOG_DIR/server.log" | tail -n 3 || echo "  (no RepGraph lines; graph disabled?)"
+
+echo "done; server CSV is under $(dirname "$UPROJECT")/Saved/Profiling/CSV"
@@ -0,0 +1,202 @@
+"""Turn gameplay telemetry files (*.oatl) into per-course heatmaps and percentile tables.
+
+Usage:
+    python telemetry_heatmap.py Saved/Telemetry/*.oatl [-o out_dir] [--cell 200]
+
+For every course found in the input files this writes one heatmap image per
+event type (PGM, or PNG when matplotlib is installed) into out_dir and prints
+percentile tables for climb duration, slow-mo duration and runner speed.
+"""
+
+import argparse
+import collections
+import os
+import struct
+import sys
+import zlib
+
+MAGIC = 0x4C54414F  # 'OATL'
+SUPPORTED_VERSIONS = (1, 2)
+
+EVENT_FMT = "<ffI3ffBBH"
+EVENT_SIZE = struct.calcsize(EVENT_FMT)
+
+EVENT_NAMES = [
+    "Position",
+    "ClimbStart",
+    "ClimbCommit",
+    "ClimbFinish",
+    "AutoClimbReject",
+    "Hang",
+    "Drop",
+    "SlowMoOn",
+    "SlowMoOff",
+    "Fall",
+]
+
+REJECT_NAMES = ["Approach", "ImpactSpeed", "NoLedge"]
+
+PERCENTILES = (50, 90, 95, 99)
+
+
+def read_file(path):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    magic, version, event_size = struct.unpack_from("<III", data, 0)
+    if magic != MAGIC:
+        raise ValueError("%s is not a telemetry file" % path)
+    if version not in SUPPORTED_VERSIONS:
+        raise ValueError("unsupported telemetry version %d" % version)
+    if event_size != EVENT_SIZE:
+        raise ValueError("unexpected event size %d" % event_size)
+
+    offset = 12
+    name_len = data[offset]
+    offset += 1
+    course = data[offset:offset + name_len].decode("utf-8")
+    offset += name_len + 8  # file start ticks
+    if version >= 2:
+        # session start ticks: shared by every rotated file of one session
+        (session,) = struct.unpack_from("<q", data, offset)
+        offset += 8
+    else:
+        session = os.path.basename(path).rsplit("_", 1)[0]
+
+    events = []
+    while offset + 8 <= len(data):
+        raw_size, compressed_size = struct.unpack_from("<II", data, offset)
+        offset += 8
+        block = data[offset:offset + compressed_size]
+        offset += compressed_size
+        if len(block) < compressed_size:
+            print("warning: %s ends with a truncated block" % path, file=sys.stderr)
+            break
+
+        raw = zlib.decompress(block)
+        if len(raw) != raw_size:
+            raise ValueError("%s: block size mismatch" % path)
+
+        for values in struct.iter_unpack(EVENT_FMT, raw):
+            game_s, real_s, runner, x, y, z, value, kind, detail, _ = values
+            events.append({
+                "game": game_s,
+                "real": real_s,
+                "session": session,
+                "runner": runner,
+                "pos": (x, y, z),
+                "value": value,
+                "type": EVENT_NAMES[kind] if kind < len(EVENT_NAMES) else "Unknown%d" % kind,
+                "detail": detail,
+            })
+
+    return course, events
+
+
+def percentile(sorted_values, p):
+    if not sorted_values:
+        return float("nan")
+    k = (len(sorted_values) - 1) * p / 100.0
+    lo = int(k)
+    hi = min(lo + 1, len(sorted_values) - 1)
+    return sorted_values[lo] + (sorted_values[hi] - sorted_values[lo]) * (k - lo)
+
+
+def paired_durations(events, start_type, end_type):
+    """Real-time seconds between each start event and the next end event of the same runner.
+
+    Real time restarts with every session, so pairs never cross sessions."""
+    open_at = {}
+    durations = []
+    for e in events:
+        key = (e["session"], e["runner"])
+        if e["type"] == start_type:
+            open_at[key] = e["real"]
+        elif e["type"] == end_type and key in open_at:
+            durations.append(e["real"] - open_at.pop(key))
+    return sorted(durations)
+
+
+def write_heatmap(path, counts, width, height):
+    peak = max(counts.values()) if counts else 1
+    try:
+        import matplotlib
+        matplotlib.use("Agg")
+        import matplotlib.pyplot as plt
+
+        grid = [[counts.get((cx, cy), 0) for cx in range(width)] for cy in range(height)]
+        plt.figure(figsize=(8, 8 * height / max(width, 1)))
+        plt.imshow(grid, origin="lower", cmap="inferno", interpolation="nearest")
+        plt.colorbar()
+        plt.title(os.path.basename(path))
+        plt.savefig(path + ".png", dpi=100)
+        plt.close()
+        return path + ".png"
+    except ImportError:
+        # no matplotlib: dependency-free grayscale PGM, +Y up
+        with open(path + ".pgm", "wb") as f:
+            f.write(b"P5\n%d %d\n255\n" % (width, height))
+            for cy in reversed(range(height)):
+                f.write(bytes(min(255, 255 * counts.get((cx, cy), 0) // peak) for cx in range(width)))
+        return path + ".pgm"
+
+
+def course_report(course, events, out_dir, cell):
+    events.sort(key=lambda e: (str(e["session"]), e["runner"], e["real"]))
+
+    xs = [e["pos"][0] for e in events]
+    ys = [e["pos"][1] for e in events]
+    min_x, min_y = min(xs), min(ys)
+    width = int((max(xs) - min_x) // cell) + 1
+    height = int((max(ys) - min_y) // cell) + 1
+
+    by_type = collections.defaultdict(list)
+    for e in events:
+        by_type[e["type"]].append(e)
+
+    print("== %s: %d events, %d runners, %dx%d cells of %g cm"
+          % (course, len(events), len({e["runner"] for e in events}), width, height, cell))
+
+    for kind, items in sorted(by_type.items()):
+        counts = collections.Counter(
+            (int((e["pos"][0] - min_x) // cell), int((e["pos"][1] - min_y) // cell)) for e in items)
+        path = write_heatmap(os.path.join(out_dir, "%s_%s" % (course, kind)), counts, width, height)
+        print("  %-16s %7d  -> %s" % (kind, len(items), path))
+
+    rejects = collections.Counter(e["detail"] for e in by_type.get("AutoClimbReject", []))
+    if rejects:
+        print("  auto-climb rejections: " + ", ".join(
+            "%s %d" % (REJECT_NAMES[d] if d < len(REJECT_NAMES) else d, n) for d, n in sorted(rejects.items())))
+
+    tables = [
+        ("climb duration (s)", paired_durations(events, "ClimbStart", "ClimbFinish")),
+        ("slow-mo duration (s)", paired_durations(events, "SlowMoOn", "SlowMoOff")),
+        ("runner speed (cm/s)", sorted(e["value"] for e in by_type.get("Position", []))),
+        ("fall location Z (cm)", sorted(e["pos"][2] for e in by_type.get("Fall", []))),
+    ]
+    print("  %-22s %7s" % ("", "count") + "".join("%10s" % ("p%d" % p) for p in PERCENTILES))
+    for name, values in tables:
+        print("  %-22s %7d" % (name, len(values)) + "".join("%10.2f" % percentile(values, p) for p in PERCENTILES))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("files", nargs="+")
+    parser.add_argument("-o", "--out", default="telemetry_report", help="output directory for heatmaps")
+    parser.add_argument("--cell", type=float, default=200.0, help="heatmap cell size in cm")
+    args = parser.parse_args()
+
+    courses = collections.defaultdict(list)
+    for path in args.files:
+        course, events = read_file(path)
+        courses[course].extend(events)
+
+    os.makedirs(args.out, exist_ok=True)
+    for course, events in sorted(courses.items()):
+        if events:
+            course_report(course, events, args.out, args.cell)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())